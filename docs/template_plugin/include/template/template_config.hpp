@@ -51,6 +51,12 @@ namespace TemplateConfigParams {
  */
 DECLARE_TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS);
 
+/**
+ * @brief Defines a delay in milliseconds added to every inference to emulate a slower device, for example,
+ * in tests of scheduling between several devices. The default value is 0.
+ */
+DECLARE_TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS);
+
 
 }  // namespace TemplateConfigParams
 }  // namespace InferenceEngine
@@ -33,6 +33,11 @@ Configuration::Configuration(const ConfigMap& config, const Configuration & defa
             }
         } else if (CONFIG_KEY(PERF_COUNT) == key) {
             perfCount = (CONFIG_VALUE(YES) == value);
+        } else if (TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS) == key) {
+            inferenceDelayMs = std::stoi(value);
+            if (inferenceDelayMs < 0) {
+                THROW_IE_EXCEPTION << "Inference delay " << inferenceDelayMs << " is not supported";
+            }
         } else if (throwOnUnsupported) {
             THROW_IE_EXCEPTION << NOT_FOUND_str << ": " << key;
         }
@@ -44,6 +49,8 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {std::to_string(deviceId)};
     } else if (name == CONFIG_KEY(PERF_COUNT)) {
         return {perfCount};
+    } else if (name == TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS)) {
+        return {std::to_string(inferenceDelayMs)};
     } else if (name == TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS) || name == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         return {std::to_string(_streamsExecutorConfig._streams)};
     } else if (name == CONFIG_KEY(CPU_BIND_THREAD)) {
@@ -31,6 +31,7 @@ struct Configuration {
 
     int deviceId                = 0;
     bool perfCount              = true;
+    int inferenceDelayMs        = 0;
     InferenceEngine::IStreamsExecutor::Config _streamsExecutorConfig;
 };
 // ! [configuration:header]
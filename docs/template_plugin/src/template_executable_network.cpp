@@ -129,7 +129,8 @@ InferenceEngine::Parameter TemplatePlugin::ExecutableNetwork::GetMetric(const st
         std::vector<std::string> configKeys = {
             CONFIG_KEY(DEVICE_ID),
             CONFIG_KEY(PERF_COUNT),
-            TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS) };
+            TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS),
+            TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS) };
         auto streamExecutorConfigKeys = IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
             configKeys.emplace_back(configKey);
@@ -8,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <thread>
+#include <chrono>
 
 #include <ie_blob.h>
 #include <description_buffer.hpp>
@@ -223,6 +225,9 @@ void TemplateInferRequest::waitPipeline() {
     auto start = Time::now();
     // TODO: Wait pipeline using driver API or other synchronizations methods
     // NOTE: not used in current implementation since `startPipeline` executes pipiline synchronously
+    if (_executableNetwork->_cfg.inferenceDelayMs > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(_executableNetwork->_cfg.inferenceDelayMs));
+    }
     _durations[WaitPipeline] = Time::now() - start;
 }
 
@@ -221,7 +221,8 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
         std::vector<std::string> configKeys = {
             CONFIG_KEY(DEVICE_ID),
             CONFIG_KEY(PERF_COUNT),
-            TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS)};
+            TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS),
+            TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS)};
         auto streamExecutorConfigKeys = IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
             if (configKey != InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
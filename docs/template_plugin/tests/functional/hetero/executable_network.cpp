@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "template/template_config.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+namespace {
+
+class HeteroTemplateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ie.RegisterPlugin("templatePlugin", "TEMPLATE0");
+        ie.RegisterPlugin("templatePlugin", "TEMPLATE1");
+    }
+
+    // The first operations up to splitIndex go to TEMPLATE0, the others go to TEMPLATE1
+    static void SetAffinity(const std::shared_ptr<ngraph::Function>& function, std::size_t splitIndex) {
+        std::size_t index = 0;
+        for (auto&& node : function->get_ordered_ops()) {
+            if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+                continue;
+            }
+            std::string affinity = index++ < splitIndex ? "TEMPLATE0" : "TEMPLATE1";
+            node->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>(affinity);
+        }
+    }
+
+    InferenceEngine::Core ie;
+    const std::string heteroDevice = "HETERO:TEMPLATE0,TEMPLATE1";
+};
+
+// Subnetworks of different requests are pipelined, so every device needs its own optimal number of requests
+TEST_F(HeteroTemplateTest, OptimalNumberOfInferRequestsIsSumOverSubnetworks) {
+    ie.SetConfig({{TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS), "1"}}, "TEMPLATE0");
+    ie.SetConfig({{TEMPLATE_CONFIG_KEY(THROUGHPUT_STREAMS), "2"}}, "TEMPLATE1");
+
+    auto function = ngraph::builder::subgraph::makeConvPoolRelu();
+    SetAffinity(function, 1);
+    auto execNet = ie.LoadNetwork(InferenceEngine::CNNNetwork(function), heteroDevice);
+    ASSERT_EQ(3u, execNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+}
+
+// Reshape_1 and Conv_1 go to TEMPLATE0, so the output of Conv_1 is the only boundary
+TEST_F(HeteroTemplateTest, BoundaryBytesAreReportedPerSubgraphPair) {
+    auto function = ngraph::builder::subgraph::makeConvPoolRelu();
+    SetAffinity(function, 2);
+    std::size_t convOutputSize = 0;
+    for (auto&& node : function->get_ops()) {
+        if (node->get_friendly_name() == "Conv_1") {
+            convOutputSize = ngraph::shape_size(node->get_output_shape(0));
+        }
+    }
+    ASSERT_NE(0u, convOutputSize);
+
+    auto execNet = ie.LoadNetwork(InferenceEngine::CNNNetwork(function), heteroDevice);
+    auto boundaryBytes = execNet.GetMetric(METRIC_KEY(HETERO_BOUNDARY_BYTES)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(1u, boundaryBytes.size());
+    ASSERT_EQ("subgraph0 -> subgraph1", boundaryBytes.begin()->first);
+    ASSERT_EQ(convOutputSize * sizeof(float), boundaryBytes.begin()->second);
+}
+
+// The blob of the boundary is bound to the consumer subnetwork in the precision and layout of the producer output
+TEST_F(HeteroTemplateTest, SharedBoundaryBlobGivesResultsOfSingleDevice) {
+    auto function = ngraph::builder::subgraph::makeConvPoolRelu();
+    InferenceEngine::CNNNetwork network(function);
+    auto inputName = network.getInputsInfo().begin()->first;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+
+    auto refRequest = ie.LoadNetwork(network, "TEMPLATE0").CreateInferRequest();
+    refRequest.SetBlob(inputName, input);
+    refRequest.Infer();
+
+    for (std::size_t splitIndex : {1, 2, 3}) {
+        SetAffinity(function, splitIndex);
+        auto request = ie.LoadNetwork(InferenceEngine::CNNNetwork(function), heteroDevice).CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), refRequest.GetBlob(outputName));
+    }
+}
+
+}  // namespace
@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "template/template_config.hpp"
+
+namespace {
+
+// Two template devices of different speed, the slower one goes first in the priority order
+TEST(MultiDeviceSchedulingTest, FasterDeviceTakesInferencesOfSingleRequest) {
+    InferenceEngine::Core ie;
+    ie.RegisterPlugin("templatePlugin", "TEMPLATE_SLOW");
+    ie.RegisterPlugin("templatePlugin", "TEMPLATE_FAST");
+    ie.SetConfig({{TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS), "20"}}, "TEMPLATE_SLOW");
+    ie.SetConfig({{TEMPLATE_CONFIG_KEY(INFERENCE_DELAY_MS), "2"}}, "TEMPLATE_FAST");
+
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    auto execNet = ie.LoadNetwork(network, "MULTI",
+        {{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), "TEMPLATE_SLOW,TEMPLATE_FAST"}});
+
+    // Each device is measured once, then the faster one takes every inference
+    const int numInferences = 50;
+    auto request = execNet.CreateInferRequest();
+    for (int i = 0; i < numInferences; i++) {
+        request.Infer();
+    }
+
+    auto shares = execNet.GetMetric(METRIC_KEY(MULTI_DEVICE_SHARES)).as<std::map<std::string, float>>();
+    ASSERT_EQ(2u, shares.size());
+    ASSERT_LE(shares["TEMPLATE_SLOW"], 2.f / numInferences);
+    ASSERT_GE(shares["TEMPLATE_FAST"], 1.f - 2.f / numInferences);
+}
+
+}  // namespace
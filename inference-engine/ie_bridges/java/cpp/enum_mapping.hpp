@@ -7,7 +7,9 @@
 static const std::map<int, InferenceEngine::ResizeAlgorithm> resize_alg_map = {
     {0, InferenceEngine::ResizeAlgorithm::NO_RESIZE},
     {1, InferenceEngine::ResizeAlgorithm::RESIZE_AREA},
-    {2, InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR}
+    {2, InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR},
+    {3, InferenceEngine::ResizeAlgorithm::RESIZE_NEAREST},
+    {4, InferenceEngine::ResizeAlgorithm::RESIZE_BICUBIC}
 };
 
 //
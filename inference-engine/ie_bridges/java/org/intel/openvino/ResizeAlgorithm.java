@@ -3,7 +3,9 @@ package org.intel.openvino;
 public enum ResizeAlgorithm {
     NO_RESIZE(0),
     RESIZE_BILINEAR(1),
-    RESIZE_AREA(2);
+    RESIZE_AREA(2),
+    RESIZE_NEAREST(3),
+    RESIZE_BICUBIC(4);
 
     private int value;
 
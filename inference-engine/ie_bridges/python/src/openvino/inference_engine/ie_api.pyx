@@ -565,6 +565,32 @@ cdef class PreProcessInfo:
     def resize_algorithm(self, alg : ResizeAlgorithm):
         deref(self._ptr).setResizeAlgorithm(alg.value)
 
+    ## Keep the aspect ratio of the input on resize and pad the rest of the network input
+    #
+    #  Usage example:\n
+    #  ```python
+    #  net = ie_core.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+    #  net.input_info['data'].preprocess_info.resize_algorithm = ResizeAlgorithm.RESIZE_BILINEAR
+    #  net.input_info['data'].preprocess_info.letterbox = True
+    #  net.input_info['data'].preprocess_info.pad_value = 114.0
+    #  ```
+    @property
+    def letterbox(self):
+        return deref(self._ptr).getLetterbox()
+
+    @letterbox.setter
+    def letterbox(self, letterbox : bool):
+        deref(self._ptr).setLetterbox(letterbox, deref(self._ptr).getPadValue())
+
+    ## Value the padded area is filled with on letterbox resize
+    @property
+    def pad_value(self):
+        return deref(self._ptr).getPadValue()
+
+    @pad_value.setter
+    def pad_value(self, value : float):
+        deref(self._ptr).setLetterbox(deref(self._ptr).getLetterbox(), value)
+
     ## Color format to be used in on-demand color conversions applied to input before inference
     #
     #  Usage example:\n
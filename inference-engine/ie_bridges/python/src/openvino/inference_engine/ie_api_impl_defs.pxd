@@ -80,6 +80,9 @@ cdef extern from "<inference_engine.hpp>" namespace "InferenceEngine":
         void setColorFormat(ColorFormat fmt)
         ResizeAlgorithm getResizeAlgorithm() const
         void setResizeAlgorithm(const ResizeAlgorithm& alg)
+        bool getLetterbox() const
+        float getPadValue() const
+        void setLetterbox(bool letterbox, float padValue)
         MeanVariant getMeanVariant() const
         void setVariant(const MeanVariant& variant)
 
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() method of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables dataflow execution of the graph inside a single stream.
+ *
+ * Nodes of independent branches (e.g. Inception blocks or multi-head detectors) are dispatched
+ * to the stream's threads as soon as all their producers are finished, instead of being
+ * executed one by one in topological order. Memory reuse is restricted accordingly, so the
+ * activation workspace may grow. Has effect only for TBB-based builds.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+ * @brief The key enables sharing of the intermediate tensors memory between streams.
+ *
+ * Each stream takes a workspace from a common pool at the start of inference and returns it back
+ * at the end, so the memory consumption is proportional to the number of concurrently running
+ * inference requests rather than to the number of streams. Constant data are kept per stream.
+ * Has no effect for networks with memory (state) layers.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(POOLED_WORKSPACE);
+
+/**
+ * @brief The key enables recording of the inference timeline.
+ *
+ * Begin and end of each executed layer and of each inference are stored together with stream, thread and
+ * inference request identifiers. The latest events are available via Metrics::METRIC_CPU_TRACE.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(TRACE);
+
+/**
+ * @brief The key enables graph-wide selection of the layers memory layouts.
+ *
+ * After each layer has chosen its implementation, layouts are refined with a cost model which takes into
+ * account the size of tensors to be reordered between layers and the efficiency of kernels for a given layout.
+ * Implementation types chosen by layers are not changed. Layouts are chosen by this estimate only, kernels are
+ * not timed while the network is loaded.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(LAYOUT_PLANNER);
+
+/**
+ * @brief The key allows to infer input blobs with dimensions different from the network ones without reloading the network.
+ *
+ * An infer request compiles the network for new input dimensions on their first use. Compiled networks are kept for
+ * a few most recently used input dimensions, so switching between them does not recompile the network. Streams share
+ * the reshaped network and the weights of the same input dimensions.
+ * Output blobs are reallocated for the output dimensions, so they should be obtained with GetBlob after the inference.
+ * Supported only for networks represented by ngraph::Function. Dynamic batch and zero-copy of input and output blobs
+ * are not used in this mode.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(DYNAMIC_SHAPES);
+
+}  // namespace CPUConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a size in bytes of the memory shared by intermediate tensors of a network
+ *        in a single stream, String value is METRIC_CPU_WORKSPACE_SIZE
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_WORKSPACE_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get a ratio of the intermediate tensors workspace size to its lower bound,
+ *        String value is METRIC_CPU_WORKSPACE_EFFICIENCY
+ *
+ * The lower bound is a max total size of tensors alive at the same time for the network execution order.
+ * 1.0 means that there is no memory waste caused by tensors placement.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_WORKSPACE_EFFICIENCY, float);
+
+/**
+ * @brief Metric to get fusions applied to the network, String value is METRIC_CPU_APPLIED_FUSIONS
+ *
+ * Maps a fusion pattern, i.e. the type of a fusing layer followed by types of fused layers joined with '+'
+ * (e.g. "Convolution+ReLU+FakeQuantize"), to the number of its occurrences in the network.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_APPLIED_FUSIONS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get latency percentiles of the network layers as a JSON string,
+ *        String value is METRIC_CPU_PERF_HISTOGRAMS
+ *
+ * Available if PluginConfigParams::KEY_PERF_COUNT is enabled. Each stream is reported separately:
+ * {"streams":[{"stream":0,"nodes":[{"name":"conv1","type":"Convolution","exec_type":"jit_avx2_FP32","count":100,
+ * "avg_us":52,"p50_us":51.2,"p90_us":55.3,"p99_us":96.2,"max_us":101.7}, ...]}, ...]}
+ * Percentiles are computed from a histogram with relative error below 12.5%.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERF_HISTOGRAMS, std::string);
+
+/**
+ * @brief Metric to get the inference timeline recorded with CPUConfigParams::KEY_CPU_TRACE enabled,
+ *        String value is METRIC_CPU_TRACE
+ *
+ * The value is a JSON string in Chrome trace event format which can be opened in chrome://tracing or Perfetto UI.
+ * Streams are shown as processes, "Inference" events cover whole inferences including inputs and outputs conversions.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_TRACE, std::string);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -36,4 +40,15 @@ namespace HeteroConfigParams {
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> of bytes that one inference moves between subnetworks
+ * of the Heterogeneous executable network. Keys have the form "subgraph<producer index> -> subgraph<consumer index>",
+ * String value is METRIC_HETERO_BOUNDARY_BYTES
+ */
+DECLARE_METRIC_KEY(HETERO_BOUNDARY_BYTES, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -349,4 +349,79 @@ public:
 
     Blob::Ptr createROI(const ROI& roi) const override;
 };
+
+/**
+ * @brief Represents several regions of one image to be pre-processed into the batch of a network input
+ *
+ * Region i is resized to the network input size and placed to the batch slot i. The regions are
+ * pre-processed in a single pass, the pre-processing is set via InputInfo::getPreProcess() or
+ * InferRequest::SetBlob() as for a memory blob.
+ */
+class INFERENCE_ENGINE_API_CLASS(ROIsBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the ROIsBlob object
+     */
+    using Ptr = std::shared_ptr<ROIsBlob>;
+
+    /**
+     * @brief A smart pointer to the const ROIsBlob object
+     */
+    using CPtr = std::shared_ptr<const ROIsBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    ROIsBlob() = delete;
+
+    /**
+     * @brief Constructs a blob from an image and its regions
+     * @param image 4D memory blob with the source images
+     * @param rois Regions of the image, ROI::id selects the image in the batch of @p image
+     */
+    ROIsBlob(const Blob::Ptr& image, const std::vector<ROI>& rois);
+
+    /**
+     * @brief A virtual destructor
+     */
+    virtual ~ROIsBlob();
+
+    /**
+     * @brief A copy constructor
+     */
+    ROIsBlob(const ROIsBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    ROIsBlob& operator=(const ROIsBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    ROIsBlob(ROIsBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    ROIsBlob& operator=(ROIsBlob&& blob) = default;
+
+    /**
+     * @brief Returns a constant reference to shared pointer to the source image
+     */
+    const Blob::Ptr& image() const noexcept;
+
+    /**
+     * @brief Returns regions of the source image
+     */
+    const std::vector<ROI>& rois() const noexcept;
+
+    /**
+     * @brief Not supported, regions of regions are created from the source image instead
+     */
+    Blob::Ptr createROI(const ROI& roi) const override;
+
+private:
+    std::vector<ROI> _rois;
+};
 }  // namespace InferenceEngine
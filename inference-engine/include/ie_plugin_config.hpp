@@ -98,6 +98,13 @@ DECLARE_METRIC_KEY(FULL_DEVICE_NAME, std::string);
  */
 DECLARE_METRIC_KEY(OPTIMIZATION_CAPABILITIES, std::vector<std::string>);
 
+/**
+ * @brief Metric which defines support of import/export functionality by plugin. String value is "IMPORT_EXPORT_SUPPORT"
+ *
+ * Devices which report `true` can be used together with the CACHE_DIR configuration key.
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
 DECLARE_METRIC_VALUE(FP32);
 DECLARE_METRIC_VALUE(BF16);
 DECLARE_METRIC_VALUE(FP16);
@@ -360,5 +367,18 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief This key defines the directory which will be used to store compiled networks.
+ *
+ * It is handled by InferenceEngine::Core and can be passed either to Core::SetConfig without a device name
+ * (the directory is then used for all devices) or to Core::LoadNetwork.
+ * If the value is not empty and the device reports METRIC_KEY(IMPORT_EXPORT_SUPPORT), the compiled network
+ * is exported to `<CACHE_DIR>/<hash>.blob` after the first LoadNetwork call, where hash is computed from
+ * the network topology, weights, inputs/outputs information, device name and compilation options.
+ * Subsequent LoadNetwork calls with the same parameters import the network from this file instead of
+ * compiling it again. An empty value (default) disables caching.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
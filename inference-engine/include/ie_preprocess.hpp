@@ -47,7 +47,7 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_NEAREST, RESIZE_BICUBIC };
 
 /**
  * @brief This class stores pre-process information for the input
@@ -63,6 +63,10 @@ class PreProcessInfo {
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
+    // Keep the aspect ratio on resize and pad the rest of the network input
+    bool _letterbox = false;
+    float _padValue = 0.f;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index
@@ -221,5 +225,38 @@ public:
     ColorFormat getColorFormat() const {
         return _colorFormat;
     }
+
+    /**
+     * @brief Enables letterbox resize for the input
+     *
+     * The input is resized with the configured resize algorithm keeping its aspect ratio,
+     * and placed in the center of the network input. The remaining area is filled with the pad value.
+     * Mean and scale values, if set, are applied to the pad value as well.
+     *
+     * @param letterbox true to enable letterbox resize
+     * @param padValue A value the padded area is filled with
+     */
+    void setLetterbox(bool letterbox, float padValue = 0.f) {
+        _letterbox = letterbox;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Checks if letterbox resize is enabled for the input
+     *
+     * @return true if letterbox resize is enabled
+     */
+    bool getLetterbox() const {
+        return _letterbox;
+    }
+
+    /**
+     * @brief Gets a value the padded area is filled with on letterbox resize
+     *
+     * @return Pad value
+     */
+    float getPadValue() const {
+        return _padValue;
+    }
 };
 }  // namespace InferenceEngine
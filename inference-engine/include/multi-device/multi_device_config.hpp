@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -35,4 +38,14 @@ namespace MultiDeviceConfigParams {
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get a std::map<std::string, float> of shares of inferences executed by every device of the
+ * Multi-Device executable network, String value is METRIC_MULTI_DEVICE_SHARES
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_SHARES, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
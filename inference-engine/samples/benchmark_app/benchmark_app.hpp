@@ -100,6 +100,21 @@ static const char dump_config_message[] = "Optional. Path to XML/YAML/JSON file
 static const char shape_message[] = "Optional. Set shape for input. For example, \"input1[1,3,224,224],input2[1,4]\" or \"[1,3,224,224]\""
                                     " in case of one input size.";
 
+/// @brief message for multi-model mode
+static const char models_message[] = "Optional. Enables multi-model mode: the models are loaded into one Core and run concurrently, "
+                                     "per-model throughput and latency are reported along with the slowdown against running alone. "
+                                     "Format: \"<path>[:d=<device>][:nstreams=<integer>][:nireq=<integer>];<path>...\". "
+                                     "Device defaults to -d value. The -m, -api, -niter, -rate, -b and -shape options are not used in this mode.";
+
+/// @brief message for the target request rate of the open-loop mode
+static const char request_rate_message[] = "Optional. Enables open-loop mode with the given target rate of inference requests per second. "
+                                           "Requests arrive independently of completion of the previous ones and wait in a queue "
+                                           "while all infer requests are busy. Applicable to the async API only.";
+
+/// @brief message for the distribution of request arrivals in the open-loop mode
+static const char arrivals_message[] = "Optional. Distribution of request arrivals in the open-loop mode: "
+                                       "\"constant\" (default) or \"poisson\".";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -142,6 +157,15 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Models to benchmark concurrently, enables multi-model mode
+DEFINE_string(models, "", models_message);
+
+/// @brief Target rate of inference requests per second, enables open-loop mode (default 0 - closed loop)
+DEFINE_double(rate, 0.0, request_rate_message);
+
+/// @brief Distribution of request arrivals in the open-loop mode
+DEFINE_string(arrivals, "constant", arrivals_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -201,6 +225,7 @@ static void showUsage() {
     std::cout << "    -h, --help                " << help_message << std::endl;
     std::cout << "    -i \"<path>\"               " << input_message << std::endl;
     std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+    std::cout << "    -models \"<list>\"          " << models_message << std::endl;
     std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
     std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
     std::cout << "          Or" << std::endl;
@@ -208,6 +233,8 @@ static void showUsage() {
     std::cout << "    -api \"<sync/async>\"       " << api_message << std::endl;
     std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << request_rate_message << std::endl;
+    std::cout << "    -arrivals \"<type>\"        " << arrivals_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
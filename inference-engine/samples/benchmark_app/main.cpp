@@ -4,9 +4,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -23,6 +28,7 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
@@ -47,14 +53,26 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+    if (FLAGS_m.empty() && FLAGS_models.empty()) {
+        throw std::logic_error("Model is required but not set. Please set -m or -models option.");
     }
 
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect request rate. Please set -rate option to a positive value.");
+    }
+
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-rate option) is supported for the async API only.");
+    }
+
+    if (FLAGS_arrivals != "constant" && FLAGS_arrivals != "poisson") {
+        throw std::logic_error("Incorrect arrivals distribution. Please set -arrivals option to `constant` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() &&
         FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -93,13 +111,31 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+// Histogram with 1-2-5 series bucket bounds in milliseconds, empty leading and trailing buckets are skipped
+StatisticsReport::Parameters getLatencyHistogram(const std::vector<double> &sortedLatencies) {
+    auto bucketName = [] (double lower, double upper) {
+        std::stringstream ss;
+        ss << lower << " - " << upper << " ms";
+        return ss.str();
+    };
+
+    StatisticsReport::Parameters histogram;
+    double lower = 0.0;
+    auto it = sortedLatencies.begin();
+    for (double decade = 0.1; it != sortedLatencies.end(); decade *= 10) {
+        for (double step : {1.0, 2.0, 5.0}) {
+            const double upper = decade * step;
+            auto next = std::upper_bound(it, sortedLatencies.end(), upper);
+            if (next != it || !histogram.empty()) {
+                histogram.emplace_back(bucketName(lower, upper), std::to_string(std::distance(it, next)));
+            }
+            lower = upper;
+            it = next;
+            if (it == sortedLatencies.end())
+                break;
+        }
+    }
+    return histogram;
 }
 
 /**
@@ -144,6 +180,18 @@ int main(int argc, char *argv[]) {
         // Parse devices
         auto devices = parseDevices(device_name);
 
+        // In the multi-model mode every model may target its own device, configure all of them
+        std::vector<ModelSpec> models;
+        if (!FLAGS_models.empty()) {
+            models = parseModels(FLAGS_models, device_name);
+            for (auto& model : models) {
+                for (auto& device : parseDevices(model.device)) {
+                    if (std::find(devices.begin(), devices.end(), device) == devices.end())
+                        devices.push_back(device);
+                }
+            }
+        }
+
         // Parse nstreams per device
         std::map<std::string, std::string> device_nstreams = parseNStreamsValuePerDevice(devices, FLAGS_nstreams);
 
@@ -305,11 +353,25 @@ int main(int argc, char *argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
-        auto double_to_string = [] (const double number) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(2) << number;
-            return ss.str();
-        };
+        if (!models.empty()) {
+            // ----------------- Multi-model benchmarking: every model alone and then all co-located ---------------
+            uint32_t duration_seconds = FLAGS_t;
+            if (duration_seconds == 0) {
+                for (auto& model : models)
+                    duration_seconds = std::max(duration_seconds, deviceDefaultDeviceDurationInSeconds(model.device));
+            }
+            if (statistics)
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"models", FLAGS_models},
+                                                  {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                          });
+            benchmarkModels(ie, models, inputFiles, duration_seconds, statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto get_total_ms_time = [] (Time::time_point& startTime) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
@@ -435,9 +497,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // In the open-loop mode requests are started at the target rate instead of as soon as a request is idle
+        const bool openLoop = FLAGS_rate > 0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -468,6 +533,13 @@ int main(int argc, char *argv[]) {
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"target request rate", double_to_string(FLAGS_rate)},
+                                                  {"request arrivals", FLAGS_arrivals},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -507,6 +579,9 @@ int main(int argc, char *argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (openLoop) {
+                ss << ", " << FLAGS_arrivals << " arrivals at " << FLAGS_rate << " requests/s";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -550,9 +625,23 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // Arrival times of the open-loop mode don't depend on completion of requests. When all requests are busy,
+        // the arrivals which are due are served as soon as requests are idle, and the delay is the queueing time.
+        // The generator has the default seed, so runs with Poisson arrivals are reproducible
+        std::mt19937 arrivalsGenerator;
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_rate : 1.0);
+        const auto nextArrivalInterval = [&]() {
+            const double seconds = FLAGS_arrivals == "poisson" ? poissonIntervals(arrivalsGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = startTime;
+
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -567,7 +656,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivalTime += nextArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -589,11 +683,27 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        // Latency of a request is the queueing time (non-zero in the open-loop mode only) plus the service time
+        std::vector<double> serviceTimes = inferRequestsQueue.getLatencies();
+        std::vector<double> queueTimes = inferRequestsQueue.getQueueTimes();
+        std::vector<double> latencies(serviceTimes.size());
+        std::transform(serviceTimes.begin(), serviceTimes.end(), queueTimes.begin(), latencies.begin(), std::plus<double>());
+        std::sort(serviceTimes.begin(), serviceTimes.end());
+        std::sort(queueTimes.begin(), queueTimes.end());
+        std::sort(latencies.begin(), latencies.end());
+
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
 
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", getPercentileValue(latencies, 50)},
+            {"p90", getPercentileValue(latencies, 90)},
+            {"p99", getPercentileValue(latencies, 99)},
+            {"p99.9", getPercentileValue(latencies, 99.9)},
+        };
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -605,6 +715,22 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                for (auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {percentile.first + " latency (ms)", double_to_string(percentile.second)},
+                                              });
+                }
+                if (openLoop) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"median queueing time (ms)", double_to_string(getMedianValue(queueTimes))},
+                                                      {"p99 queueing time (ms)", double_to_string(getPercentileValue(queueTimes, 99))},
+                                                      {"median service time (ms)", double_to_string(getMedianValue(serviceTimes))},
+                                                      {"p99 service time (ms)", double_to_string(getPercentileValue(serviceTimes, 99))},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::LATENCY_HISTOGRAM, getLatencyHistogram(latencies));
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -654,8 +780,19 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            for (auto& percentile : latencyPercentiles) {
+                std::cout << "    " << std::left << std::setw(8) << percentile.first
+                          << double_to_string(percentile.second) << " ms" << std::endl;
+            }
+            if (openLoop) {
+                std::cout << "Queueing:   " << double_to_string(getMedianValue(queueTimes)) << " ms median, "
+                          << double_to_string(getPercentileValue(queueTimes, 99)) << " ms p99" << std::endl;
+                std::cout << "Service:    " << double_to_string(getMedianValue(serviceTimes)) << " ms median, "
+                          << double_to_string(getPercentileValue(serviceTimes, 99)) << " ms p99" << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -0,0 +1,218 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "multi_model.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct LoadedModel {
+    std::string name;
+    std::string device;
+    size_t batchSize = 0;
+    ExecutableNetwork exeNetwork;
+    std::unique_ptr<InferRequestsQueue> requests;
+};
+
+struct RunResult {
+    size_t iterations = 0;
+    double fps = 0.0;
+    std::vector<double> latencies;
+};
+
+std::map<std::string, std::string> getModelConfig(Core& ie, const ModelSpec& model) {
+    std::map<std::string, std::string> config;
+    if (model.nstreams.empty())
+        return config;
+    const std::string key = model.device + "_THROUGHPUT_STREAMS";
+    std::vector<std::string> supported_config_keys = ie.GetMetric(model.device, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(supported_config_keys.begin(), supported_config_keys.end(), key) == supported_config_keys.end()) {
+        throw std::logic_error("Device " + model.device + " doesn't support config key '" + key + "'! " +
+                               "Please remove nstreams option for model " + model.path);
+    }
+    config[key] = model.nstreams;
+    return config;
+}
+
+std::unique_ptr<LoadedModel> loadModel(Core& ie, const ModelSpec& model, const std::vector<std::string>& inputFiles) {
+    std::unique_ptr<LoadedModel> loaded(new LoadedModel);
+    loaded->device = model.device;
+
+    CNNNetwork cnnNetwork = ie.ReadNetwork(model.path);
+    const InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+    if (inputInfo.empty()) {
+        throw std::logic_error("no inputs info is provided for model " + model.path);
+    }
+    for (auto& item : inputInfo) {
+        if (isImage(item.second)) {
+            item.second->setPrecision(Precision::U8);
+        }
+    }
+    loaded->name = cnnNetwork.getName();
+    loaded->batchSize = cnnNetwork.getBatchSize();
+    if (loaded->batchSize == 0) {
+        loaded->batchSize = 1;
+    }
+
+    auto startTime = Time::now();
+    loaded->exeNetwork = ie.LoadNetwork(cnnNetwork, model.device, getModelConfig(ie, model));
+    auto duration_ms = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+    slog::info << "Load network " << model.path << " to " << model.device << " took " << double_to_string(duration_ms) << " ms" << slog::endl;
+
+    uint32_t nireq = model.nireq;
+    if (nireq == 0) {
+        try {
+            nireq = loaded->exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const std::exception& ex) {
+            throw std::logic_error("Every device used for multi-model benchmarking should support " +
+                                   std::string(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) +
+                                   " metric, or nireq should be set for the model " + model.path + ". " +
+                                   "Failed to query the metric for the " + model.device + " with error:" + ex.what());
+        }
+    }
+    loaded->requests.reset(new InferRequestsQueue(loaded->exeNetwork, nireq));
+    fillBlobs(inputFiles, loaded->batchSize, loaded->exeNetwork.GetInputsInfo(), loaded->requests->requests);
+
+    // warming up - out of scope of the measurements
+    loaded->requests->getIdleRequest()->startAsync();
+    loaded->requests->waitAll();
+    return loaded;
+}
+
+/// @brief Runs the models simultaneously, each one in a closed asynchronous loop driven by its own thread
+std::vector<RunResult> runModels(const std::vector<LoadedModel*>& models, uint64_t duration_nanoseconds) {
+    std::vector<RunResult> results(models.size());
+    std::vector<std::exception_ptr> errors(models.size());
+    std::vector<std::thread> threads;
+    for (auto& model : models) {
+        model->requests->resetTimes();
+    }
+    auto startTime = Time::now();
+    for (size_t i = 0; i < models.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                auto& queue = *models[i]->requests;
+                const size_t nireq = queue.requests.size();
+                size_t iteration = 0;
+                // align the number of iterations to guarantee that the last infer requests are executed
+                // in the same conditions
+                while ((static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - startTime).count()) < duration_nanoseconds) ||
+                       (iteration % nireq)) {
+                    auto inferRequest = queue.getIdleRequest();
+                    if (!inferRequest) {
+                        THROW_IE_EXCEPTION << "No idle Infer Requests!";
+                    }
+                    inferRequest->startAsync();
+                    iteration++;
+                }
+                queue.waitAll();
+
+                auto& result = results[i];
+                result.iterations = iteration;
+                result.fps = models[i]->batchSize * 1000.0 * iteration / queue.getDurationInMilliseconds();
+                result.latencies = queue.getLatencies();
+                std::sort(result.latencies.begin(), result.latencies.end());
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return results;
+}
+
+}  // namespace
+
+void benchmarkModels(Core& ie,
+                     const std::vector<ModelSpec>& models,
+                     const std::vector<std::string>& inputFiles,
+                     uint32_t duration_seconds,
+                     const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<std::unique_ptr<LoadedModel>> loaded;
+    std::vector<LoadedModel*> all;
+    for (auto& model : models) {
+        loaded.push_back(loadModel(ie, model, inputFiles));
+        all.push_back(loaded.back().get());
+    }
+    const uint64_t duration_nanoseconds = duration_seconds * 1000000000LL;
+
+    std::vector<RunResult> alone;
+    for (auto& model : loaded) {
+        slog::info << "Measuring " << model->name << " on " << model->device << " alone for "
+                   << duration_seconds << " seconds" << slog::endl;
+        alone.push_back(runModels({model.get()}, duration_nanoseconds).front());
+    }
+
+    slog::info << "Measuring " << loaded.size() << " co-located models for " << duration_seconds << " seconds" << slog::endl;
+    std::vector<RunResult> colocated = runModels(all, duration_nanoseconds);
+
+    auto latencyString = [] (const RunResult& result) {
+        return double_to_string(getPercentileValue(result.latencies, 50.0)) + " / " +
+               double_to_string(getPercentileValue(result.latencies, 99.0));
+    };
+
+    double aggregate = 0.0;
+    std::cout << std::endl;
+    std::cout << std::left << std::setw(4) << "#" << std::setw(32) << "Model" << std::setw(12) << "Device"
+              << std::setw(14) << "Alone FPS" << std::setw(18) << "Co-located FPS" << std::setw(12) << "Slowdown"
+              << std::setw(24) << "Alone p50/p99 (ms)" << "Co-located p50/p99 (ms)" << std::endl;
+    for (size_t i = 0; i < loaded.size(); i++) {
+        // a model may complete no requests in the measured time
+        const double slowdown = alone[i].fps > 0.0 ? 100.0 * (1.0 - colocated[i].fps / alone[i].fps) : 0.0;
+        aggregate += colocated[i].fps;
+        std::cout << std::left << std::setw(4) << i << std::setw(32) << loaded[i]->name << std::setw(12) << loaded[i]->device
+                  << std::setw(14) << double_to_string(alone[i].fps) << std::setw(18) << double_to_string(colocated[i].fps)
+                  << std::setw(12) << (double_to_string(slowdown) + " %") << std::setw(24) << latencyString(alone[i])
+                  << latencyString(colocated[i]) << std::endl;
+
+        if (statistics) {
+            const std::string prefix = std::to_string(i) + ": " + loaded[i]->name + " on " + loaded[i]->device + ", ";
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {prefix + "throughput alone", double_to_string(alone[i].fps)},
+                                              {prefix + "throughput co-located", double_to_string(colocated[i].fps)},
+                                              {prefix + "slowdown (%)", double_to_string(slowdown)},
+                                              {prefix + "p50 latency alone (ms)", double_to_string(getPercentileValue(alone[i].latencies, 50.0))},
+                                              {prefix + "p99 latency alone (ms)", double_to_string(getPercentileValue(alone[i].latencies, 99.0))},
+                                              {prefix + "p50 latency co-located (ms)",
+                                                      double_to_string(getPercentileValue(colocated[i].latencies, 50.0))},
+                                              {prefix + "p99 latency co-located (ms)",
+                                                      double_to_string(getPercentileValue(colocated[i].latencies, 99.0))},
+                                      });
+        }
+    }
+    std::cout << std::endl << "Aggregate throughput: " << double_to_string(aggregate) << " FPS" << std::endl;
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                          {"aggregate throughput co-located", double_to_string(aggregate)},
+                                  });
+    }
+}
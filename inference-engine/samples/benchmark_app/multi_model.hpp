@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "statistics_report.hpp"
+#include "utils.hpp"
+
+/**
+ * @brief Benchmarks several networks co-located on the same host.
+ *
+ * Every model is measured alone first and then together with all the others, each model driving its own
+ * closed asynchronous loop from a separate thread. All networks are loaded by the same Core object, so models
+ * targeting the same device share its plugin and executors, as a serving process would. Per-model throughput
+ * and latency for both runs, the slowdown caused by co-location and the aggregate throughput are reported.
+ */
+void benchmarkModels(InferenceEngine::Core& ie,
+                     const std::vector<ModelSpec>& models,
+                     const std::vector<std::string>& inputFiles,
+                     uint32_t duration_seconds,
+                     const std::shared_ptr<StatisticsReport>& statistics);
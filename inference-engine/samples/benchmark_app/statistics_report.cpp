@@ -50,6 +50,14 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::LATENCY_HISTOGRAM)) {
+        dumper << "Latency histogram";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::LATENCY_HISTOGRAM));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
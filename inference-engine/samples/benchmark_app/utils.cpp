@@ -4,6 +4,8 @@
 
 #include <string>
 #include <algorithm>
+#include <iomanip>
+#include <sstream>
 #include <utility>
 #include <vector>
 #include <map>
@@ -18,6 +20,12 @@
 #include <opencv2/core.hpp>
 #endif
 
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device) {
     static const std::map<std::string, uint32_t> deviceDefaultDurationInSeconds {
             { "CPU",     60  },
@@ -102,6 +110,66 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
     return result;
 }
 
+std::vector<ModelSpec> parseModels(const std::string& models_string, const std::string& default_device) {
+    //  Format: <path>[:d=<device>][:nstreams=<value>][:nireq=<value>];<path>...
+    //  Options start at the first ":<key>=" so paths and device names may contain ':'
+    static const std::regex option_start(":(d|nstreams|nireq)=");
+    std::vector<ModelSpec> result;
+    for (auto& model_string : split(models_string, ';')) {
+        if (model_string.empty())
+            continue;
+        ModelSpec model;
+        model.device = default_device;
+        std::smatch match;
+        std::string options;
+        if (std::regex_search(model_string, match, option_start)) {
+            model.path = model_string.substr(0, match.position(0));
+            options = model_string.substr(match.position(0) + 1);
+        } else {
+            model.path = model_string;
+        }
+        if (model.path.empty()) {
+            throw std::logic_error("Model path is not specified in '" + model_string + "'");
+        }
+
+        std::vector<std::pair<std::string, std::string>> values;
+        while (!options.empty()) {
+            auto key_end = options.find('=');
+            std::string key = options.substr(0, key_end);
+            options = options.substr(key_end + 1);
+            std::string value = options;
+            if (std::regex_search(options, match, option_start)) {
+                value = options.substr(0, match.position(0));
+                options = options.substr(match.position(0) + 1);
+            } else {
+                options.clear();
+            }
+            values.emplace_back(key, value);
+        }
+        for (auto& item : values) {
+            if (item.second.empty()) {
+                throw std::logic_error("Value of '" + item.first + "' is not specified for model " + model.path);
+            }
+            if (item.first == "d") {
+                model.device = item.second;
+            } else if (item.first == "nstreams") {
+                model.nstreams = item.second;
+            } else if (item.first == "nireq") {
+                try {
+                    model.nireq = static_cast<uint32_t>(std::stoul(item.second));
+                } catch (const std::exception&) {
+                    throw std::logic_error("Incorrect nireq value '" + item.second + "' for model " + model.path);
+                }
+            }
+        }
+        result.push_back(model);
+    }
+    if (result.empty()) {
+        throw std::logic_error("No models are specified in '" + models_string + "'");
+    }
+    return result;
+}
+
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info) {
     bool updated = false;
@@ -4,11 +4,42 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <map>
 
+/// @brief A model of the multi-model mode with its own device and execution parameters
+struct ModelSpec {
+    std::string path;
+    std::string device;
+    std::string nstreams;
+    uint32_t nireq = 0;
+};
+
+template <typename T>
+T getMedianValue(const std::vector<T> &vec) {
+    std::vector<T> sortedVec(vec);
+    std::sort(sortedVec.begin(), sortedVec.end());
+    return (sortedVec.size() % 2 != 0) ?
+           sortedVec[sortedVec.size() / 2ULL] :
+           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+}
+
+// Nearest-rank percentile of sorted values, 0 if there are no values
+template <typename T>
+T getPercentileValue(const std::vector<T> &sortedVec, double percentile) {
+    if (sortedVec.empty())
+        return static_cast<T>(0);
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::max<size_t>(rank, 1) - 1];
+}
+
+// Fixed-point string with two decimals used for all reported times and rates
+std::string double_to_string(const double number);
 std::vector<std::string> parseDevices(const std::string& device_string);
+std::vector<ModelSpec> parseModels(const std::string& models_string, const std::string& default_device);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
                                                                const std::string& values_string);
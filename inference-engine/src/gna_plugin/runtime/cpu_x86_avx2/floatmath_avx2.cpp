@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "runtime/floatmath_blocked.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+namespace {
+
+inline float reduceAdd(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_hadd_ps(sum, sum);
+    sum = _mm_hadd_ps(sum, sum);
+    return _mm_cvtss_f32(sum);
+}
+
+template <uint32_t R, uint32_t C>
+void dotTileFixed(const float *const *a, const float *const *b, uint32_t k, float *sums) {
+    __m256 acc[R][C];
+    for (uint32_t r = 0; r < R; r++) {
+        for (uint32_t c = 0; c < C; c++) {
+            acc[r][c] = _mm256_setzero_ps();
+        }
+    }
+    uint32_t i = 0;
+    for (; i + 8 <= k; i += 8) {
+        __m256 vb[C];
+        for (uint32_t c = 0; c < C; c++) {
+            vb[c] = _mm256_loadu_ps(b[c] + i);
+        }
+        for (uint32_t r = 0; r < R; r++) {
+            const __m256 va = _mm256_loadu_ps(a[r] + i);
+            for (uint32_t c = 0; c < C; c++) {
+                acc[r][c] = _mm256_fmadd_ps(va, vb[c], acc[r][c]);
+            }
+        }
+    }
+    for (uint32_t r = 0; r < R; r++) {
+        for (uint32_t c = 0; c < C; c++) {
+            float sum = reduceAdd(acc[r][c]);
+            for (uint32_t j = i; j < k; j++) {
+                sum += a[r][j] * b[c][j];
+            }
+            sums[r * C + c] += sum;
+        }
+    }
+}
+
+}  // namespace
+
+void dotTile(const float *const *a, uint32_t rows, const float *const *b, uint32_t cols, uint32_t k, float *sums) {
+    if (rows == 4 && cols == 2) {
+        dotTileFixed<4, 2>(a, b, k, sums);
+    } else if (rows == 4 && cols == 1) {
+        dotTileFixed<4, 1>(a, b, k, sums);
+    } else {
+        for (uint32_t r = 0; r < rows; r++) {
+            for (uint32_t c = 0; c < cols; c++) {
+                dotTileFixed<1, 1>(a + r, b + c, k, sums + r * cols + c);
+            }
+        }
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <immintrin.h>
+
+#include "runtime/floatmath_blocked.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+namespace {
+
+inline float reduceAdd(__m512 v) {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, v);
+    float sum = 0.0f;
+    for (float lane : lanes) {
+        sum += lane;
+    }
+    return sum;
+}
+
+template <uint32_t R, uint32_t C>
+void dotTileFixed(const float *const *a, const float *const *b, uint32_t k, float *sums) {
+    __m512 acc[R][C];
+    for (uint32_t r = 0; r < R; r++) {
+        for (uint32_t c = 0; c < C; c++) {
+            acc[r][c] = _mm512_setzero_ps();
+        }
+    }
+    uint32_t i = 0;
+    for (; i + 16 <= k; i += 16) {
+        __m512 vb[C];
+        for (uint32_t c = 0; c < C; c++) {
+            vb[c] = _mm512_loadu_ps(b[c] + i);
+        }
+        for (uint32_t r = 0; r < R; r++) {
+            const __m512 va = _mm512_loadu_ps(a[r] + i);
+            for (uint32_t c = 0; c < C; c++) {
+                acc[r][c] = _mm512_fmadd_ps(va, vb[c], acc[r][c]);
+            }
+        }
+    }
+    for (uint32_t r = 0; r < R; r++) {
+        for (uint32_t c = 0; c < C; c++) {
+            float sum = reduceAdd(acc[r][c]);
+            for (uint32_t j = i; j < k; j++) {
+                sum += a[r][j] * b[c][j];
+            }
+            sums[r * C + c] += sum;
+        }
+    }
+}
+
+}  // namespace
+
+void dotTile(const float *const *a, uint32_t rows, const float *const *b, uint32_t cols, uint32_t k, float *sums) {
+    if (rows == 4 && cols == 2) {
+        dotTileFixed<4, 2>(a, b, k, sums);
+    } else if (rows == 4 && cols == 1) {
+        dotTileFixed<4, 1>(a, b, k, sums);
+    } else {
+        for (uint32_t r = 0; r < rows; r++) {
+            for (uint32_t c = 0; c < cols; c++) {
+                dotTileFixed<1, 1>(a + r, b + c, k, sums + r * cols + c);
+            }
+        }
+    }
+}
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
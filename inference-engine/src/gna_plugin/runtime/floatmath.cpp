@@ -1,13 +1,14 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, matrix products without transposition run blocked kernels
 //
 
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "floatmath_blocked.hpp"
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +28,14 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                for (j = 0; j < N; j++) {
+                    C[i * ldc + j] = 0;
                 }
-                C[i * ldc + j] = sum;
             }
         }
+        GNAPluginNS::runtime::sgemmBlocked(M, N, K, A, lda, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +105,14 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (beta != 1.0) {
+            for (l = 0; l < L; l++) {
+                for (j = 0; j < N; j++) {
+                    C[l * ldc + j] = 0;
                 }
-                C[l * ldc + j] = sum;
             }
         }
+        GNAPluginNS::runtime::sgemmBlocked(L, N, K, A, lda, B, ldb, C, ldc, OutputList);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,20 +151,7 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    GNAPluginNS::runtime::sgemvSplitBlocked(N, K1, K2, A1, A2, X, B, C);
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#include "floatmath_blocked.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+
+// length of the K block, a tile of A rows and the gathered columns of B stay in L1/L2 caches while it is processed
+constexpr uint32_t kBlockK = 1024;
+// number of output rows processed by one parallel task
+constexpr uint32_t kBlockRows = 8 * kDotTileRows;
+// problems with less multiply-adds are computed on the calling thread
+constexpr uint64_t kParallelThreshold = 1 << 16;
+
+DotTileFunc selectDotTile() {
+#ifdef HAVE_AVX512
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        return avx512::dotTile;
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        return avx2::dotTile;
+    }
+#endif
+    return GNAPluginNS::runtime::dotTile;
+}
+
+DotTileFunc getDotTile() {
+    static const DotTileFunc func = selectDotTile();
+    return func;
+}
+
+template <typename F>
+void forEachRowBlock(uint32_t rows, uint64_t work, const F &body) {
+    const uint32_t blocks = (rows + kBlockRows - 1) / kBlockRows;
+    auto block = [&](uint32_t b) {
+        body(b * kBlockRows, std::min(rows, (b + 1) * kBlockRows));
+    };
+    if (work < kParallelThreshold || blocks < 2) {
+        for (uint32_t b = 0; b < blocks; b++) {
+            block(b);
+        }
+    } else {
+        InferenceEngine::parallel_for(blocks, block);
+    }
+}
+
+}  // namespace
+
+void GNAPluginNS::runtime::dotTile(const float *const *a, uint32_t rows,
+                                   const float *const *b, uint32_t cols,
+                                   uint32_t k, float *sums) {
+    for (uint32_t r = 0; r < rows; r++) {
+        for (uint32_t c = 0; c < cols; c++) {
+            float sum = 0.0f;
+            for (uint32_t i = 0; i < k; i++) {
+                sum += a[r][i] * b[c][i];
+            }
+            sums[r * cols + c] += sum;
+        }
+    }
+}
+
+void GNAPluginNS::runtime::sgemmBlocked(uint32_t M, uint32_t N, uint32_t K,
+                                        const float *A, uint32_t lda,
+                                        const float *B, uint32_t ldb,
+                                        float *C, uint32_t ldc,
+                                        const uint32_t *rowList) {
+    if (M == 0 || N == 0 || K == 0) {
+        return;
+    }
+
+    // columns of B are gathered into contiguous rows, so that every dot product runs over unit-stride data
+    const float *Bt = B;
+    std::vector<float> gathered;
+    if (N != 1 || ldb != 1) {
+        gathered.resize(static_cast<size_t>(N) * K);
+        for (uint32_t k = 0; k < K; k++) {
+            for (uint32_t j = 0; j < N; j++) {
+                gathered[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+            }
+        }
+        Bt = gathered.data();
+    }
+
+    const auto dot = getDotTile();
+    forEachRowBlock(M, static_cast<uint64_t>(M) * N * K, [&](uint32_t first, uint32_t last) {
+        const float *a[kDotTileRows];
+        const float *b[kDotTileCols];
+        float sums[kDotTileRows * kDotTileCols];
+        for (uint32_t k0 = 0; k0 < K; k0 += kBlockK) {
+            const uint32_t kb = std::min(kBlockK, K - k0);
+            for (uint32_t i = first; i < last; i += kDotTileRows) {
+                const uint32_t rows = std::min(kDotTileRows, last - i);
+                for (uint32_t r = 0; r < rows; r++) {
+                    const uint32_t row = rowList ? rowList[i + r] : i + r;
+                    a[r] = A + static_cast<size_t>(row) * lda + k0;
+                }
+                for (uint32_t j = 0; j < N; j += kDotTileCols) {
+                    const uint32_t cols = std::min(kDotTileCols, N - j);
+                    for (uint32_t c = 0; c < cols; c++) {
+                        b[c] = Bt + static_cast<size_t>(j + c) * K + k0;
+                    }
+                    std::fill(sums, sums + rows * cols, 0.0f);
+                    dot(a, rows, b, cols, kb, sums);
+                    for (uint32_t r = 0; r < rows; r++) {
+                        for (uint32_t c = 0; c < cols; c++) {
+                            C[static_cast<size_t>(i + r) * ldc + j + c] += sums[r * cols + c];
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+void GNAPluginNS::runtime::sgemvSplitBlocked(uint32_t N, uint32_t K1, uint32_t K2,
+                                             const float *A1, const float *A2,
+                                             const float *X, const float *B, float *C) {
+    const uint32_t K = K1 + K2;
+    const auto dot = getDotTile();
+    forEachRowBlock(N, static_cast<uint64_t>(N) * K, [&](uint32_t first, uint32_t last) {
+        const float *x[kDotTileRows];
+        float sums[kDotTileRows];
+        for (uint32_t i = first; i < last; i += kDotTileRows) {
+            const uint32_t rows = std::min(kDotTileRows, last - i);
+            for (uint32_t r = 0; r < rows; r++) {
+                x[r] = X + static_cast<size_t>(i + r) * K;
+                sums[r] = B[i + r];
+            }
+            dot(x, rows, &A1, 1, K1, sums);
+            for (uint32_t r = 0; r < rows; r++) {
+                x[r] += K1;
+            }
+            dot(x, rows, &A2, 1, K2, sums);
+            for (uint32_t r = 0; r < rows; r++) {
+                C[i + r] = sums[r];
+            }
+        }
+    });
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// floatmath_blocked.hpp : cache-blocked, vectorized and multi-threaded matrix products of the float runtime
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Maximal number of vectors taken from a and b by one call of the dot tile kernel
+ */
+constexpr uint32_t kDotTileRows = 4;
+constexpr uint32_t kDotTileCols = 2;
+
+/**
+ * @brief Dot tile kernel: sums[r * cols + c] += dot(a[r], b[c]) for rows <= kDotTileRows vectors of a,
+ * cols <= kDotTileCols vectors of b, all of them of length k and contiguous
+ */
+using DotTileFunc = void (*)(const float *const *a, uint32_t rows,
+                             const float *const *b, uint32_t cols,
+                             uint32_t k, float *sums);
+
+void dotTile(const float *const *a, uint32_t rows, const float *const *b, uint32_t cols, uint32_t k, float *sums);
+
+#ifdef HAVE_AVX2
+namespace avx2 {
+void dotTile(const float *const *a, uint32_t rows, const float *const *b, uint32_t cols, uint32_t k, float *sums);
+}  // namespace avx2
+#endif
+
+#ifdef HAVE_AVX512
+namespace avx512 {
+void dotTile(const float *const *a, uint32_t rows, const float *const *b, uint32_t cols, uint32_t k, float *sums);
+}  // namespace avx512
+#endif
+
+/**
+ * @brief C += A * B, where A is M x K and B is K x N row-major matrices
+ * @param rowList optional list of M rows of A to use for the rows of C, the whole A is used if nullptr
+ */
+void sgemmBlocked(uint32_t M, uint32_t N, uint32_t K,
+                  const float *A, uint32_t lda,
+                  const float *B, uint32_t ldb,
+                  float *C, uint32_t ldc,
+                  const uint32_t *rowList = nullptr);
+
+/**
+ * @brief C = [ A1 A2 ] * X + B, where X is N x (K1 + K2) row-major matrix
+ */
+void sgemvSplitBlocked(uint32_t N, uint32_t K1, uint32_t K2,
+                       const float *A1, const float *A2,
+                       const float *X, const float *B, float *C);
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -16,6 +16,13 @@
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Runs each subnetwork of the request as a separate pipeline stage on the device owning it.
+ *
+ * A stage starts the subnetwork request and the next stage is started from its completion callback,
+ * so while one request is on the second device the first device is free to process the next request.
+ * Intermediate blobs are owned by HeteroInferRequest, so every request in flight has its own set.
+ */
 class HeteroAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
     using Ptr = std::shared_ptr<HeteroAsyncInferRequest>;
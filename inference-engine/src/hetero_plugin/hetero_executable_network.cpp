@@ -22,6 +22,8 @@
 #include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <functional>
+#include <numeric>
 
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
@@ -144,6 +146,12 @@ void dumpGraph(InferenceEngine::ICNNNetwork &network,
     saveGraphToDot(network, stream, split_color);
 }
 
+// FP32 and I32 inputs are accepted by all devices HETERO runs on, so intermediate blobs of these
+// precisions are bound to the consumer subnetwork as-is. FP16 is not: the CPU plugin rejects FP16 inputs
+bool isSharedBoundaryPrecision(const Precision& precision) {
+    return precision == Precision::FP32 || precision == Precision::I32;
+}
+
 }   // namespace
 
 void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& network_) {
@@ -661,6 +669,27 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
                                             });
         ++id;
     }
+    // Intermediate blobs are shared between subnetworks without copies, so a subnetwork input
+    // takes the precision and layout of the output it is fed from. The consumer device then converts
+    // the data while reading its input instead of requiring a separate conversion at the boundary.
+    // Other precisions are not forced on the consumer, as its device may not accept them for inputs
+    std::unordered_map<std::string, DataPtr> subnetworkOutputs;
+    for (auto&& network : networks) {
+        for (auto&& input : network._clonedNetwork.getInputsInfo()) {
+            auto itName = _blobNameMap.find(input.first);
+            if (itName == _blobNameMap.end()) {
+                continue;
+            }
+            auto itOutput = subnetworkOutputs.find(itName->second);
+            if (itOutput != subnetworkOutputs.end() && isSharedBoundaryPrecision(itOutput->second->getPrecision())) {
+                input.second->setPrecision(itOutput->second->getPrecision());
+                input.second->setLayout(itOutput->second->getLayout());
+            }
+        }
+        for (auto&& output : network._clonedNetwork.getOutputsInfo()) {
+            subnetworkOutputs.emplace(output.first, output.second);
+        }
+    }
     if (dumpDotFile) {
         ngraph::pass::VisualizeTree{"hetero_subgraphs_" + _name + ".dot",
             [&] (const ngraph::Node& node, std::vector<std::string>& attributes) {
@@ -1013,7 +1042,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(HETERO_BOUNDARY_BYTES)
         };
 
         {
@@ -1058,11 +1088,37 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // subnetworks of different requests are pipelined across devices,
+        // so each device stage needs its own set of requests to stay busy
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (METRIC_KEY(HETERO_BOUNDARY_BYTES) == name) {
+        std::map<std::string, uint64_t> boundaryBytes;
+        for (std::size_t consumer = 0; consumer < networks.size(); ++consumer) {
+            for (auto&& input : networks[consumer]._network.GetInputsInfo()) {
+                auto intermediateBlobName = input.first;
+                auto itName = _blobNameMap.find(input.first);
+                if (itName != _blobNameMap.end()) {
+                    intermediateBlobName = itName->second;
+                }
+                for (std::size_t producer = 0; producer < consumer; ++producer) {
+                    auto producerOutputs = networks[producer]._network.GetOutputsInfo();
+                    if (contains(producerOutputs, intermediateBlobName)) {
+                        const auto& desc = input.second->getTensorDesc();
+                        const auto& dims = desc.getDims();
+                        auto bytes = std::accumulate(dims.begin(), dims.end(),
+                                                     static_cast<uint64_t>(desc.getPrecision().size()),
+                                                     std::multiplies<uint64_t>());
+                        boundaryBytes["subgraph" + std::to_string(producer) + " -> subgraph" + std::to_string(consumer)] += bytes;
+                        break;
+                    }
+                }
+            }
+        }
+        IE_SET_METRIC_RETURN(HETERO_BOUNDARY_BYTES, boundaryBytes);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
@@ -6,6 +6,8 @@
 #include "hetero_ade_util.hpp"
 
 #include <cassert>
+#include <functional>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -146,16 +148,67 @@ std::vector<LayersSet> splitGraph(ICNNNetwork& network,
     return finalSubgraphs;
 }
 
+namespace {
+std::size_t dataBytes(const DataPtr& data) {
+    const auto& desc = data->getTensorDesc();
+    const auto& dims = desc.getDims();
+    return std::accumulate(dims.begin(), dims.end(), desc.getPrecision().size(), std::multiplies<std::size_t>());
+}
+
+/// Estimates the traffic over the border of the subgraph. The splitter serves networks without
+/// an nGraph function, and those pass all intermediate data in FP32 (see InitCNNImpl), so data of
+/// other precisions is counted twice as it is converted on both sides of the cut. Networks with
+/// a function are split by affinities alone and keep FP32 and I32 data as-is (see InitNgraph)
+std::size_t boundaryCost(const LayersSet& subgraph) {
+    std::size_t cost = 0;
+    std::unordered_set<Data*> boundaryData;
+    auto addBoundaryData = [&](const DataPtr& data) {
+        if (boundaryData.insert(data.get()).second) {
+            auto bytes = dataBytes(data);
+            cost += data->getPrecision() == Precision::FP32 ? bytes : 2 * bytes;
+        }
+    };
+    for (auto&& layer : subgraph) {
+        assert(nullptr != layer);
+        for (auto&& dataIt : layer->insData) {
+            auto data = dataIt.lock();
+            assert(nullptr != data);
+            auto prevLayer = getCreatorLayer(data).lock();
+            if (nullptr != prevLayer && prevLayer->type != "Input" && !ade::util::contains(subgraph, prevLayer)) {
+                addBoundaryData(data);
+            }
+        }
+        for (auto&& data : layer->outData) {
+            for (auto&& nextLayer : getInputTo(data)) {
+                if (!ade::util::contains(subgraph, nextLayer.second)) {
+                    addBoundaryData(data);
+                    break;
+                }
+            }
+        }
+    }
+    return cost;
+}
+}  // namespace
+
 ISplitChecker::GraphSelectionResult DefaultSplitChecker::selectSubgraph(
         const std::vector<LayersSet>& subgraphs) {
     assert(!subgraphs.empty());
+    // Take the largest subgraph first, among subgraphs of the same size prefer the one
+    // with the cheapest border, so cut points fall on small tensors that need no conversion
     std::size_t index = 0;
     auto maxSize = subgraphs[0].size();
+    auto minCost = boundaryCost(subgraphs[0]);
     for (auto i : ade::util::iota(std::size_t(1), subgraphs.size())) {
         auto size = subgraphs[i].size();
-        if (size > maxSize) {
-            index = 1;
+        if (size < maxSize) {
+            continue;
+        }
+        auto cost = boundaryCost(subgraphs[i]);
+        if (size > maxSize || cost < minCost) {
+            index = i;
             maxSize = size;
+            minCost = cost;
         }
     }
     GraphSelectionResult ret;
@@ -0,0 +1,232 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+
+#include "ie_itt.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Incremental 64-bit hash. Input is consumed by 8-byte words with MurmurHash64A mixing,
+ *        so hashing of large weights blobs does not dominate LoadNetwork time.
+ */
+class HashBuilder {
+public:
+    void update(const void* data, std::size_t size) {
+        auto bytes = static_cast<const std::uint8_t*>(data);
+        for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), bytes += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            mix(word);
+        }
+        if (size != 0) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, bytes, size);
+            mix(word);
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value, HashBuilder&>::type operator<<(const T value) {
+        update(&value, sizeof(value));
+        return *this;
+    }
+
+    HashBuilder& operator<<(const std::string& value) {
+        *this << value.size();
+        update(value.data(), value.size());
+        return *this;
+    }
+
+    template <typename T>
+    HashBuilder& operator<<(const std::vector<T>& values) {
+        *this << values.size();
+        for (auto&& value : values) {
+            *this << value;
+        }
+        return *this;
+    }
+
+    std::string str() const {
+        auto hash = _hash;
+        hash ^= hash >> shift;
+        hash *= multiplier;
+        hash ^= hash >> shift;
+        std::stringstream stream;
+        stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return stream.str();
+    }
+
+private:
+    void mix(std::uint64_t word) {
+        word *= multiplier;
+        word ^= word >> shift;
+        word *= multiplier;
+        _hash ^= word;
+        _hash *= multiplier;
+    }
+
+    static constexpr std::uint64_t multiplier = 0xc6a4a7935bd1e995ULL;
+    static constexpr int shift = 47;
+    std::uint64_t _hash = 0x9e3779b97f4a7c15ULL;
+};
+
+constexpr std::uint64_t HashBuilder::multiplier;
+constexpr int HashBuilder::shift;
+
+/**
+ * @brief Feeds names and values of all visited attributes into the hash
+ */
+class HashAttributeVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashAttributeVisitor(HashBuilder& hash) : _hash(hash) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        // attributes without typed accessor are covered by output element types and shapes
+        _hash << name << std::string(adapter.get_type_info().name);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hash << name << adapter.size();
+        _hash.update(adapter.get_ptr(), adapter.size());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { hash(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { hash(name, adapter); }
+
+private:
+    template <typename T>
+    void hash(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        _hash << name << adapter.get();
+    }
+
+    HashBuilder& _hash;
+};
+
+bool hashFunction(HashBuilder& hash, const ngraph::Function& function) {
+    std::unordered_map<const ngraph::Node*, std::size_t> nodeIndexes;
+    for (auto&& node : function.get_ordered_ops()) {
+        nodeIndexes.emplace(node.get(), nodeIndexes.size());
+
+        hash << std::string(node->get_type_name()) << node->get_version() << node->get_friendly_name();
+
+        for (auto&& input : node->input_values()) {
+            hash << nodeIndexes.at(input.get_node()) << input.get_index();
+        }
+        for (auto&& output : node->outputs()) {
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            hash << output.get_element_type().get_type_name() << shape.str();
+        }
+
+        HashAttributeVisitor visitor(hash);
+        if (!node->visit_attributes(visitor)) {
+            // attributes of the operation are unknown, so two different networks may get the same hash
+            return false;
+        }
+
+        if (auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+            auto body = subGraph->get_function();
+            if (body == nullptr || !hashFunction(hash, *body)) {
+                return false;
+            }
+        }
+
+        for (auto&& rtInfo : node->get_rt_info()) {
+            hash << rtInfo.first;
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtInfo.second)) {
+                hash << value->get();
+            }
+        }
+    }
+    return true;
+}
+
+void hashIOInfo(HashBuilder& hash, const CNNNetwork& network) {
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& preProcess = input.second->getPreProcess();
+        hash << input.first << std::string(input.second->getPrecision().name())
+             << static_cast<int>(input.second->getLayout())
+             << static_cast<int>(preProcess.getResizeAlgorithm())
+             << static_cast<int>(preProcess.getColorFormat())
+             << static_cast<int>(preProcess.getMeanVariant())
+             << preProcess.getLetterbox() << preProcess.getPadValue();
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            const auto& channel = preProcess[c];
+            hash << channel->meanValue << channel->stdScale;
+            if (channel->meanData) {
+                hash << channel->meanData->byteSize();
+                hash.update(channel->meanData->cbuffer().as<const void*>(), channel->meanData->byteSize());
+            }
+        }
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        hash << output.first << std::string(output.second->getPrecision().name())
+             << static_cast<int>(output.second->getLayout());
+    }
+}
+
+}  // namespace
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "NetworkCompilationContext::computeHash");
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        return {};
+    }
+
+    HashBuilder hash;
+    if (!hashFunction(hash, *function)) {
+        return {};
+    }
+    hashIOInfo(hash, network);
+    for (auto&& option : compileOptions) {
+        hash << option.first << option.second;
+    }
+    return hash.str();
+}
+
+}  // namespace InferenceEngine
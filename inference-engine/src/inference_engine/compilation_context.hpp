@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for the compiled networks cache helpers
+ * @file compilation_context.hpp
+ */
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include <map>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes identifiers of compiled networks used as names of cache entries
+ */
+struct NetworkCompilationContext final {
+    /**
+     * @brief Computes a hash of a network and options it is compiled with
+     * @param network A network to compute hash for. Topology, operation attributes, weights,
+     *        inputs / outputs information and pre-processing are taken into account
+     * @param compileOptions Options affecting compilation result, e.g. device name and configuration
+     * @return A hex string with the hash value or empty string if the network cannot be identified
+     *         reliably (e.g. it is not represented by ngraph::Function or some operations do not
+     *         expose their attributes)
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::map<std::string, std::string>& compileOptions);
+};
+
+}  // namespace InferenceEngine
@@ -6,6 +6,8 @@
 
 #include <ie_blob.h>
 #include <istream>
+#include <string>
+#include <typeinfo>
 
 InferenceEngine::details::BlobStream::BlobBuffer::BlobBuffer(const InferenceEngine::Blob::CPtr& blob) {
     char* data = nullptr;
@@ -50,6 +52,25 @@ InferenceEngine::Blob::CPtr InferenceEngine::details::BlobStream::getBlob() {
     return blob;
 }
 
+bool InferenceEngine::details::BlobStream::isShareable() const {
+    return shareable;
+}
+
+InferenceEngine::details::BlobStream* InferenceEngine::details::BlobStream::fromStream(std::istream& stream) {
+    BlobStream* blobStream = dynamic_cast<BlobStream*>(&stream);
+    if (blobStream == nullptr) {
+        BlobStream helper({});
+        std::string typeStream = typeid(stream).name();
+        std::string typeBlobStream = typeid(helper).name();
+        if (typeStream == typeBlobStream)
+            blobStream = static_cast<BlobStream*>(&stream);
+    }
+    return blobStream;
+}
+
 InferenceEngine::details::BlobStream::BlobStream(const InferenceEngine::Blob::CPtr& blob): buffer(blob), std::ios(0), std::istream(&buffer), blob(blob) {}
 
+InferenceEngine::details::BlobStream::BlobStream(const InferenceEngine::Blob::CPtr& blob, bool shareable):
+    buffer(blob), std::ios(0), std::istream(&buffer), blob(blob), shareable(shareable) {}
+
 InferenceEngine::details::BlobStream::~BlobStream() {}
@@ -192,6 +192,26 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
     }
 }
 
+void verifyROIsBlobInput(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    if (image == nullptr || !image->is<MemoryBlob>()) {
+        THROW_IE_EXCEPTION << "Image must be a valid MemoryBlob object";
+    }
+    const auto& dims = image->getTensorDesc().getDims();
+    if (dims.size() != 4) {
+        THROW_IE_EXCEPTION << "Image must be a 4D blob, actual number of dimensions: " << dims.size();
+    }
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "At least one ROI must be provided";
+    }
+    for (const auto& roi : rois) {
+        if (roi.id >= dims[0] || roi.sizeX == 0 || roi.sizeY == 0 ||
+            roi.posX + roi.sizeX > dims[3] || roi.posY + roi.sizeY > dims[2]) {
+            THROW_IE_EXCEPTION << "ROI (" << roi.id << ", " << roi.posX << ", " << roi.posY << ", " << roi.sizeX
+                               << ", " << roi.sizeY << ") is out of the image bounds";
+        }
+    }
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -412,4 +432,28 @@ Blob::Ptr I420Blob::createROI(const ROI& roi) const {
     return std::make_shared<I420Blob>(yRoiBlob, uRoiBlob, vRoiBlob);
 }
 
+ROIsBlob::ROIsBlob(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    // verify data is correct
+    verifyROIsBlobInput(image, rois);
+    // set blobs
+    _blobs.emplace_back(image);
+    _rois = rois;
+    tensorDesc = TensorDesc(image->getTensorDesc().getPrecision(), {}, image->getTensorDesc().getLayout());
+}
+
+ROIsBlob::~ROIsBlob() {}
+
+const Blob::Ptr& ROIsBlob::image() const noexcept {
+    // NOTE: image is a memory blob, which is checked in the constructor
+    return _blobs[0];
+}
+
+const std::vector<ROI>& ROIsBlob::rois() const noexcept {
+    return _rois;
+}
+
+Blob::Ptr ROIsBlob::createROI(const ROI&) const {
+    THROW_IE_EXCEPTION << "ROI of ROIsBlob is not supported, create it from the image instead";
+}
+
 }  // namespace InferenceEngine
@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
+#include <fstream>
 #include <mutex>
+#include <sstream>
+#include <thread>
+#include <cstdio>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
@@ -17,11 +22,13 @@
 #include <ngraph/pass/constant_folding.hpp>
 
 #include <cpp_interfaces/exception2status.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "compilation_context.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -175,6 +182,47 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    std::string cacheDir;
+    mutable std::mutex cacheDirMutex;  // to lock parallel access to cacheDir
+
+    bool DeviceSupportsImportExport(const InferencePlugin& plugin) const {
+        std::vector<std::string> supportedMetricKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        auto it = std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(),
+                            METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        return (it != supportedMetricKeys.end()) && plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+    }
+
+    bool DeviceSupportsConfigKey(const InferencePlugin& plugin, const std::string& key) const {
+        std::vector<std::string> supportedConfigKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+        return std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), key) != supportedConfigKeys.end();
+    }
+
+    std::string CalculateNetworkHash(const CNNNetwork& network, const std::string& deviceName,
+                                     const InferencePlugin& plugin,
+                                     const std::map<std::string, std::string>& config) const {
+        // everything which may change the compiled network except the network itself
+        std::map<std::string, std::string> compileOptions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) {
+                compileOptions = it->second.defaultConfig;
+            }
+        }
+        for (auto&& value : config) {
+            compileOptions[value.first] = value.second;
+        }
+        compileOptions["DEVICE_NAME"] = deviceName;
+        compileOptions["IE_BUILD_NUMBER"] = GetInferenceEngineVersion()->buildNumber;
+        try {
+            compileOptions[METRIC_KEY(FULL_DEVICE_NAME)] =
+                plugin.GetMetric(METRIC_KEY(FULL_DEVICE_NAME), {}).as<std::string>();
+        } catch (const details::InferenceEngineException&) {
+            // not all devices report full name
+        }
+        return NetworkCompilationContext::computeHash(network, compileOptions);
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -271,7 +319,72 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+
+        std::string networkCacheDir = GetCacheDir();
+        auto itCacheDir = parsed._config.find(CONFIG_KEY(CACHE_DIR));
+        if (itCacheDir != parsed._config.end()) {
+            networkCacheDir = itCacheDir->second;
+            parsed._config.erase(itCacheDir);
+        }
+
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        if (networkCacheDir.empty() || !DeviceSupportsImportExport(plugin)) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        auto blobId = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+        if (blobId.empty()) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+        auto blobFileName = FileUtils::makePath(networkCacheDir, blobId + ".blob");
+
+        // the key does not change the compiled network, so it is not a part of the hash
+        auto loadConfig = parsed._config;
+        if (DeviceSupportsConfigKey(plugin, CONFIG_KEY_INTERNAL(EXPORTABLE_NETWORK))) {
+            loadConfig[CONFIG_KEY_INTERNAL(EXPORTABLE_NETWORK)] = CONFIG_VALUE(YES);
+        }
+
+        {
+            std::ifstream blobFile(blobFileName, std::ios::binary);
+            if (blobFile.is_open()) {
+                OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork::ImportFromCache");
+                try {
+                    return plugin.ImportNetwork(blobFile, parsed._config);
+                } catch (const std::exception&) {
+                    // the entry is outdated or corrupted, it is overwritten below
+                }
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(network, loadConfig);
+
+        // a unique temporary file is renamed to the final one, so concurrent
+        // LoadNetwork calls never observe partially written cache entries
+        std::stringstream tmpFileName;
+        tmpFileName << blobFileName << "." << std::this_thread::get_id() << ".tmp";
+        try {
+            {
+                OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork::ExportToCache");
+                std::ofstream tmpFile(tmpFileName.str(), std::ios::binary);
+                if (!tmpFile.is_open()) {
+                    THROW_IE_EXCEPTION << "Cannot create file " << tmpFileName.str();
+                }
+                executableNetwork.Export(tmpFile);
+                tmpFile.close();
+                if (!tmpFile.good()) {
+                    THROW_IE_EXCEPTION << "Cannot write file " << tmpFileName.str();
+                }
+            }
+            std::remove(blobFileName.c_str());
+            if (0 != std::rename(tmpFileName.str().c_str(), blobFileName.c_str())) {
+                std::remove(tmpFileName.str().c_str());
+            }
+        } catch (const std::exception&) {
+            // caching is an optimization, so export errors do not fail LoadNetwork
+            std::remove(tmpFileName.str().c_str());
+        }
+
+        return executableNetwork;
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -478,6 +591,24 @@ public:
         }
     }
 
+    /**
+     * @brief Sets the directory used to store compiled networks
+     * @param dir A path to the directory. Empty value disables caching
+     */
+    void SetCacheDir(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(cacheDirMutex);
+        cacheDir = dir;
+    }
+
+    /**
+     * @brief Returns the directory used to store compiled networks
+     * @return A path to the directory or empty string if caching is disabled
+     */
+    std::string GetCacheDir() const {
+        std::lock_guard<std::mutex> lock(cacheDirMutex);
+        return cacheDir;
+    }
+
     /**
      * @brief Registers the extension in a Core object
      *        Such extensions can be used for both CNNNetwork readers and device plugins
@@ -606,6 +737,9 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, RemoteContext::Pt
     DeviceIDParser device(deviceName_);
     std::string deviceName = device.getDeviceName();
 
+    // networks compiled for remote contexts are not cached
+    config_.erase(CONFIG_KEY(CACHE_DIR));
+
     return _impl->GetCPPPluginByName(deviceName).LoadNetwork(network, config_, context);
 }
 
@@ -707,10 +841,25 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // CACHE_DIR is handled by Core itself and is not passed to plugins
+    auto config_ = config;
+    auto itCacheDir = config_.find(CONFIG_KEY(CACHE_DIR));
+    if (itCacheDir != config_.end()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << CONFIG_KEY(CACHE_DIR) << " is set for all devices at once, so SetConfig must be "
+                                  "called without a device name. Pass it to LoadNetwork to use a directory for one network";
+        }
+        _impl->SetCacheDir(itCacheDir->second);
+        config_.erase(itCacheDir);
+        if (config_.empty()) {
+            return;
+        }
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(config_, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config_);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
@@ -733,6 +882,10 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
         }
     }
 
+    if (name == CONFIG_KEY(CACHE_DIR)) {
+        return _impl->GetCacheDir();
+    }
+
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
     // we need to return a copy of Parameter object which is created on Core side,
@@ -0,0 +1,32 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for memory mapped files
+ * @file ie_mapped_file.hpp
+ */
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Maps a whole file into memory in read-only mode.
+ *
+ * Pages are loaded lazily and are shared with other processes which map the same file.
+ * The blob data must not be modified. The mapping is released together with the last reference
+ * to the returned blob.
+ * @param path A path to the file
+ * @return A one-dimensional U8 blob referring to the mapped memory or nullptr if the file
+ *         cannot be mapped (e.g. it is empty or the system does not support mapping)
+ */
+Blob::Ptr mapFileToBlob(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
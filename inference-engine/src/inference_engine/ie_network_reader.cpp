@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_file.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -199,7 +200,15 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                // Map weights file to share its pages between processes and let readers refer
+                // to the mapped memory instead of copying weights
+                if (auto weights = details::mapFileToBlob(bPath)) {
+                    details::BlobStream binStream(weights, true);
+                    auto network = reader->read(modelStream, binStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+                // Open weights file if it cannot be mapped
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MappedFileBlob : public TBlob<uint8_t> {
+public:
+    MappedFileBlob(void* data, size_t size) :
+        TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), static_cast<uint8_t*>(data), size),
+        _data(data), _size(size) {}
+
+    ~MappedFileBlob() override {
+        munmap(_data, _size);
+    }
+
+private:
+    void* _data;
+    size_t _size;
+};
+
+}  // namespace
+
+Blob::Ptr mapFileToBlob(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1 || sb.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(sb.st_size);
+
+    // read-only mapping: weights are never written, so a stray write faults instead of copying a page
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps a reference to the file
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    return std::make_shared<MappedFileBlob>(data, size);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
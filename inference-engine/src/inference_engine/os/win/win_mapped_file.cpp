@@ -0,0 +1,72 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mapped_file.hpp"
+#include "file_utils.h"
+
+#include <memory>
+#include <string>
+
+#include <windows.h>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class MappedFileBlob : public TBlob<uint8_t> {
+public:
+    MappedFileBlob(HANDLE mapping, void* data, size_t size) :
+        TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), static_cast<uint8_t*>(data), size),
+        _mapping(mapping), _data(data) {}
+
+    ~MappedFileBlob() override {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+    }
+
+private:
+    HANDLE _mapping;
+    void* _data;
+};
+
+}  // namespace
+
+Blob::Ptr mapFileToBlob(const std::string& path) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+    std::wstring widePath = FileUtils::multiByteCharToWString(path.c_str());
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(fileSize.QuadPart);
+
+    // read-only view: weights are never written, so a stray write faults instead of copying a page
+    HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // the mapping keeps a reference to the file
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return nullptr;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+
+    return std::make_shared<MappedFileBlob>(mapping, data, size);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include <queue>
 #include <atomic>
 #include <climits>
+#include <cstdint>
 #include <cassert>
 #include <utility>
 
@@ -25,7 +26,94 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue.
+ *        Each cell holds a sequence number which tells producers and consumers whether the cell is free or ready.
+ */
+template<typename T>
+class BoundedMPMCQueue {
+public:
+    explicit BoundedMPMCQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size <<= 1;
+        _cells.reset(new Cell[size]);
+        _mask = size - 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(T& value) {
+        auto pos = _enqueuePos._value.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& value) {
+        auto pos = _dequeuePos._value.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = {};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    // Producers and consumers positions are kept on separate cache lines
+    struct Position {
+        char                        _pad[64];
+        std::atomic<std::size_t>    _value = {0};
+    };
+
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    Position                    _enqueuePos;
+    Position                    _dequeuePos;
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    /**
+     * @brief Capacity of the per-stream task queue. Tasks which do not fit go to the shared overflow queue.
+     */
+    static constexpr std::size_t streamQueueCapacity = 1024;
+
+    /**
+     * @brief Number of failed dequeue attempts an idle thread makes before it sleeps on the condition variable
+     */
+    static constexpr int spinCount = 64;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public tbb::task_scheduler_observer {
@@ -66,11 +154,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
-                : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -159,18 +243,48 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new BoundedMPMCQueue<Task>{streamQueueCapacity});
+        }
+        // Each worker steals from the streams on the same NUMA node first
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            std::vector<int> localQueues, remoteQueues;
+            for (auto i = 1; i < _config._streams; ++i) {
+                auto victimId = (streamId + i) % _config._streams;
+                if (GetNumaNodeId(victimId) == GetNumaNodeId(streamId)) {
+                    localQueues.push_back(victimId);
+                } else {
+                    remoteQueues.push_back(victimId);
+                }
+            }
+            _localVictims.emplace_back(std::move(localQueues));
+            _remoteVictims.emplace_back(std::move(remoteQueues));
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    for (int spin = 0; !task; ++spin) {
+                        // The epoch is read before the attempt, so a task enqueued after the attempt fails
+                        // changes the epoch and does not let the thread fall asleep
+                        auto epoch = _taskEpoch.load();
+                        if (Dequeue(streamId, task)) break;
+                        if (spin < spinCount) {
+                            std::this_thread::yield();
+                            continue;
+                        }
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        ++_sleepingThreads;
+                        _queueCondVar.wait(lock, [&] { return epoch != _taskEpoch || (stopped = _isStopped); });
+                        --_sleepingThreads;
+                        if (stopped) {
+                            // Drain the queues before exit
+                            lock.unlock();
+                            stopped = !Dequeue(streamId, task);
+                            break;
                         }
+                        spin = 0;
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -180,12 +294,54 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    int GetNumaNodeId(int streamId) const {
+        return _config._streams
+            ? _usedNumaNodes.at(
+                (streamId % _config._streams)/
+                ((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size()))
+            : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
     void Enqueue(Task task) {
-        {
+        auto queueId = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _taskQueues.size();
+        // While overflowed tasks are pending the per-stream queues are bypassed, so the queues drain
+        // and consumers reach the overflowed tasks before any newer task
+        if ((_overflowSize.load() != 0) || !_taskQueues[queueId]->TryPush(task)) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.emplace(std::move(task));
+            ++_overflowSize;
+        }
+        // The sequentially consistent pair of _taskEpoch and _sleepingThreads updates guarantees that
+        // either the producer sees a sleeping consumer or the consumer sees the new epoch before it sleeps
+        ++_taskEpoch;
+        if (_sleepingThreads > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryPop(int queueId, Task& task) {
+        return _taskQueues[queueId]->TryPop(task);
+    }
+
+    bool Dequeue(int streamId, Task& task) {
+        if (TryPop(streamId, task)) return true;
+        for (auto victimId : _localVictims[streamId]) {
+            if (TryPop(victimId, task)) return true;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                task = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                --_overflowSize;
+                return true;
+            }
+        }
+        for (auto victimId : _remoteVictims[streamId]) {
+            if (TryPop(victimId, task)) return true;
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -223,7 +379,15 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::vector<std::unique_ptr<BoundedMPMCQueue<Task>>> _taskQueues;
+    std::vector<std::vector<int>>           _localVictims;
+    std::vector<std::vector<int>>           _remoteVictims;
+    std::atomic<std::size_t>                _nextQueue = {0};
+    std::atomic<std::size_t>                _taskEpoch = {0};
+    std::atomic<int>                        _sleepingThreads = {0};
+    std::mutex                              _overflowMutex;
+    std::queue<Task>                        _overflowQueue;
+    std::atomic<std::size_t>                _overflowSize = {0};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
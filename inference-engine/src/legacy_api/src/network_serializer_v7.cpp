@@ -15,7 +15,7 @@
 #include "legacy/ie_layers.h"
 #include "xml_parse_utils.h"
 #include "exec_graph_info.hpp"
-#include "network_serializer_v7.hpp"
+#include "legacy/network_serializer_v7.hpp"
 
 namespace InferenceEngine {
 namespace Serialization {
@@ -497,6 +497,11 @@ std::size_t FillXmlDoc(const InferenceEngine::ICNNNetwork& network, pugi::xml_do
         }
     }
 
+    if (dumpWeights) {
+        // mean images are stored right after weights by SerializeBlobs
+        dataOffset = updatePreProcInfo(network, netXml, dataOffset);
+    }
+
     return dataOffset;
 }
 
@@ -584,5 +589,16 @@ void Serialize(const std::string& xmlPath, const std::string& binPath,
         }
     }
 }
+
+void Serialize(std::ostream& xmlStream, std::ostream& binStream, const InferenceEngine::ICNNNetwork& network) {
+    pugi::xml_document doc;
+    FillXmlDoc(network, doc, false, true);
+    doc.save(xmlStream, nullptr, pugi::format_raw);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during writing IR xml content";
+    }
+
+    SerializeBlobs(binStream, network);
+}
 }  //  namespace Serialization
 }  //  namespace InferenceEngine
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 
 #include <cpp_interfaces/exception2status.hpp>
@@ -77,6 +78,36 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_POOLED_WORKSPACE) {
+            if (val == PluginConfigParams::YES) pooledWorkspace = true;
+            else if (val == PluginConfigParams::NO) pooledWorkspace = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_POOLED_WORKSPACE
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_TRACE) {
+            if (val == PluginConfigParams::YES) trace = true;
+            else if (val == PluginConfigParams::NO) trace = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_TRACE
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_LAYOUT_PLANNER) {
+            if (val == PluginConfigParams::YES) layoutPlanner = true;
+            else if (val == PluginConfigParams::NO) layoutPlanner = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_LAYOUT_PLANNER
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES) {
+            if (val == PluginConfigParams::YES) dynamicShapes = true;
+            else if (val == PluginConfigParams::NO) dynamicShapes = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -87,6 +118,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK) == 0) {
+            if (val == PluginConfigParams::YES) exportableNetwork = true;
+            else if (val == PluginConfigParams::NO) exportableNetwork = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -139,6 +176,36 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (parallelBranches == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+
+        if (pooledWorkspace == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, PluginConfigParams::NO });
+
+        if (trace == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_TRACE, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_TRACE, PluginConfigParams::NO });
+
+        if (layoutPlanner == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_PLANNER, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_LAYOUT_PLANNER, PluginConfigParams::NO });
+
+        if (dynamicShapes == true)
+            _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::NO });
+
+        if (exportableNetwork == true)
+            _config.insert({ PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
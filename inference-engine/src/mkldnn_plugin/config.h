@@ -21,6 +21,12 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    bool pooledWorkspace = false;
+    bool trace = false;
+    bool layoutPlanner = false;
+    bool dynamicShapes = false;
+    bool exportableNetwork = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
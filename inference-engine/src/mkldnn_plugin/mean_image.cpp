@@ -5,6 +5,7 @@
 #include "mean_image.h"
 #include "ie_parallel.hpp"
 #include "nodes/common/cpu_memcpy.h"
+#include "ngraph/type/bfloat16.hpp"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -24,6 +25,17 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
         THROW_IE_EXCEPTION << "channels mismatch between mean and input";
     }
 
+    // scales are kept only if some of them are meaningful
+    scaleValues.resize(inChannels);
+    bool hasScales = false;
+    for (unsigned channel = 0; channel < inChannels; channel++) {
+        scaleValues[channel] = pp[channel]->stdScale;
+        hasScales = hasScales || scaleValues[channel] != 1.0f;
+    }
+    if (!hasScales) {
+        scaleValues.clear();
+    }
+
     switch (pp.getMeanVariant()) {
         case MEAN_VALUE: {
             // mean image common value per channel (1x1xC)
@@ -106,4 +118,176 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input, InferenceEng
             });
         }
     }
+
+    if (!scaleValues.empty()) {
+        int C = inputDims[1];
+        int spatialSize = inputDims.size() / MB / C;
+
+        if (layout == NCHW) {
+            parallel_for3d(MB, C, spatialSize, [&](int mb, int c, int i) {
+                input[mb * C * spatialSize + c * spatialSize + i] *= scaleValues[c];
+            });
+        } else if (layout == NHWC) {
+            parallel_for2d(MB, spatialSize, [&](int mb, int i) {
+                for (int c = 0; c < C; c++)
+                    input[mb * spatialSize * C + i * C + c] *= scaleValues[c];
+            });
+        }
+    }
+}
+
+bool MeanImage::IsOutputFormatSupported(mkldnn::memory::format format) {
+    return format == mkldnn::memory::nchw || format == mkldnn::memory::nhwc ||
+           format == mkldnn::memory::nChw8c || format == mkldnn::memory::nChw16c;
+}
+
+bool MeanImage::IsOutputPrecisionSupported(Precision precision) {
+    return precision == Precision::FP32 || precision == Precision::BF16;
+}
+
+namespace {
+
+inline void storeConverted(float *dst, float value) {
+    *dst = value;
+}
+
+inline void storeConverted(uint16_t *dst, float value) {
+    *dst = ngraph::bfloat16::round_to_nearest_even(value);
+}
+
+}  // namespace
+
+void MeanImage::SubtractConvert(const MKLDNNDims &inputDims, const Blob::Ptr &input, Layout layout, const MKLDNNMemory &output) {
+    IE_ASSERT(input != nullptr);
+
+    if (inputDims.ndims() != 4) {
+        THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+    }
+
+    if (layout != NCHW && layout != NHWC) {
+        THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+    }
+
+    const auto outputDataType = output.GetDataType();
+    if ((outputDataType != mkldnn::memory::f32 && outputDataType != mkldnn::memory::bf16) ||
+            !IsOutputFormatSupported(output.GetFormat())) {
+        THROW_IE_EXCEPTION << "Unsupported output memory format " << MKLDNNMemory::formatToString(output.GetFormat())
+                           << " for mean image subtraction.";
+    }
+
+    if (input->size() != inputDims.size()) {
+        THROW_IE_EXCEPTION << "Input blob size is not equal to the network input size.";
+    }
+
+    if (outputDataType == mkldnn::memory::bf16) {
+        SubtractConvertTo<uint16_t>(inputDims, input, layout, output);
+    } else {
+        SubtractConvertTo<float>(inputDims, input, layout, output);
+    }
+}
+
+template <typename D>
+void MeanImage::SubtractConvertTo(const MKLDNNDims &inputDims, const Blob::Ptr &input, Layout layout, const MKLDNNMemory &output) {
+    auto src = input->cbuffer();
+    switch (input->getTensorDesc().getPrecision()) {
+        case Precision::FP32:
+            SubtractConvertImpl<float, D>(inputDims, src.as<const float *>(), layout, output);
+            break;
+        case Precision::I32:
+            SubtractConvertImpl<int32_t, D>(inputDims, src.as<const int32_t *>(), layout, output);
+            break;
+        case Precision::I16:
+            SubtractConvertImpl<int16_t, D>(inputDims, src.as<const int16_t *>(), layout, output);
+            break;
+        case Precision::U16:
+            SubtractConvertImpl<uint16_t, D>(inputDims, src.as<const uint16_t *>(), layout, output);
+            break;
+        case Precision::I8:
+            SubtractConvertImpl<int8_t, D>(inputDims, src.as<const int8_t *>(), layout, output);
+            break;
+        case Precision::U8:
+        case Precision::BOOL:
+            SubtractConvertImpl<uint8_t, D>(inputDims, src.as<const uint8_t *>(), layout, output);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Mean image of type " << input->getTensorDesc().getPrecision().name() << " is unsupported";
+    }
+}
+
+template <typename T, typename D>
+void MeanImage::SubtractConvertImpl(const MKLDNNDims &inputDims, const T *input, Layout layout, const MKLDNNMemory &output) {
+    const size_t MB = inputDims[0];
+    const size_t C = inputDims[1];
+    const size_t H = inputDims[2];
+    const size_t W = inputDims[3];
+
+    // plain and channel blocked formats differ only in the way channels are addressed
+    const auto &blocking = output.GetDescriptor().data.layout_desc.blocking;
+    const size_t channelBlock = blocking.block_dims[1];
+    const ptrdiff_t dstStrideN = blocking.strides[0][0];
+    const ptrdiff_t dstStrideH = blocking.strides[0][2];
+    const ptrdiff_t dstStrideW = blocking.strides[0][3];
+    std::vector<ptrdiff_t> dstChannelOffsets(C);
+    bool denseChannels = true;
+    for (size_t c = 0; c < C; c++) {
+        dstChannelOffsets[c] = (c / channelBlock) * blocking.strides[0][1] + (c % channelBlock) * blocking.strides[1][1];
+        denseChannels = denseChannels && dstChannelOffsets[c] == static_cast<ptrdiff_t>(c);
+    }
+    D *dst = reinterpret_cast<D *>(output.GetData()) + blocking.offset_padding;
+
+    const float *meanBufferValues = (meanBuffer && meanBuffer->size()) ? meanBuffer->readOnly() : nullptr;
+    std::vector<float> means(meanValues.empty() ? std::vector<float>(C, 0.0f) : meanValues);
+    std::vector<float> scales(scaleValues.empty() ? std::vector<float>(C, 1.0f) : scaleValues);
+
+    // The inner loops below with unit strides on both sides are kept separate from the strided ones,
+    // so the compiler vectorizes them
+    if (layout == NCHW) {
+        parallel_for3d(MB, C, H, [&](size_t mb, size_t c, size_t h) {
+            const T *srcRow = input + ((mb * C + c) * H + h) * W;
+            D *dstRow = dst + mb * dstStrideN + dstChannelOffsets[c] + h * dstStrideH;
+            const float scale = scales[c];
+
+            if (meanBufferValues) {
+                const float *meanRow = meanBufferValues + (c * H + h) * W;
+                if (dstStrideW == 1) {
+                    for (size_t w = 0; w < W; w++)
+                        storeConverted(dstRow + w, (static_cast<float>(srcRow[w]) - meanRow[w]) * scale);
+                } else {
+                    for (size_t w = 0; w < W; w++)
+                        storeConverted(dstRow + w * dstStrideW, (static_cast<float>(srcRow[w]) - meanRow[w]) * scale);
+                }
+            } else {
+                const float mean = means[c];
+                if (dstStrideW == 1) {
+                    for (size_t w = 0; w < W; w++)
+                        storeConverted(dstRow + w, (static_cast<float>(srcRow[w]) - mean) * scale);
+                } else {
+                    for (size_t w = 0; w < W; w++)
+                        storeConverted(dstRow + w * dstStrideW, (static_cast<float>(srcRow[w]) - mean) * scale);
+                }
+            }
+        });
+    } else {
+        parallel_for2d(MB, H, [&](size_t mb, size_t h) {
+            const T *srcRow = input + (mb * H + h) * W * C;
+            D *dstRow = dst + mb * dstStrideN + h * dstStrideH;
+
+            for (size_t w = 0; w < W; w++) {
+                const T *srcPixel = srcRow + w * C;
+                D *dstPixel = dstRow + w * dstStrideW;
+                if (meanBufferValues) {
+                    for (size_t c = 0; c < C; c++) {
+                        const float mean = meanBufferValues[(c * H + h) * W + w];
+                        storeConverted(dstPixel + dstChannelOffsets[c], (static_cast<float>(srcPixel[c]) - mean) * scales[c]);
+                    }
+                } else if (denseChannels) {
+                    for (size_t c = 0; c < C; c++)
+                        storeConverted(dstPixel + c, (static_cast<float>(srcPixel[c]) - means[c]) * scales[c]);
+                } else {
+                    for (size_t c = 0; c < C; c++)
+                        storeConverted(dstPixel + dstChannelOffsets[c], (static_cast<float>(srcPixel[c]) - means[c]) * scales[c]);
+                }
+            }
+        });
+    }
 }
@@ -7,6 +7,7 @@
 #include "ie_input_info.hpp"
 
 #include "mkldnn_dims.h"
+#include "mkldnn_memory.h"
 #include "ie_parallel.hpp"
 #include <vector>
 #include <limits>
@@ -21,6 +22,20 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * Per-channel stdScale values are applied after the mean subtraction, also for inputs without mean
+     * (MeanVariant::NONE).
+     *
+     * Converts the input to FP32, subtracts the mean and applies the scales writing the result
+     * straight to the output memory, so the input is read only once.
+     * The output may have FP32 or BF16 precision and plain (nchw, nhwc) or channel blocked (nChw8c, nChw16c) format.
+     */
+    void SubtractConvert(const MKLDNNDims &inputDims, const InferenceEngine::Blob::Ptr &input,
+                         InferenceEngine::Layout layout, const MKLDNNMemory &output);
+
+    static bool IsOutputFormatSupported(mkldnn::memory::format format);
+    static bool IsOutputPrecisionSupported(InferenceEngine::Precision precision);
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -73,7 +88,15 @@ public:
     }
 
 private:
+    template <typename D>
+    void SubtractConvertTo(const MKLDNNDims &inputDims, const InferenceEngine::Blob::Ptr &input,
+                           InferenceEngine::Layout layout, const MKLDNNMemory &output);
+
+    template <typename T, typename D>
+    void SubtractConvertImpl(const MKLDNNDims &inputDims, const T *input, InferenceEngine::Layout layout, const MKLDNNMemory &output);
+
     std::vector<float> meanValues;
+    std::vector<float> scaleValues;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
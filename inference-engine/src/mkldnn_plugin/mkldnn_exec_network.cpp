@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -23,6 +24,7 @@
 #include "low_precision_transformations/transformer.hpp"
 #endif
 
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
@@ -31,6 +33,10 @@
 #include <utility>
 #include <cstring>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <legacy/network_serializer_v7.hpp>
+#include <sstream>
+#include <cstdint>
+#include <pugixml.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -45,15 +51,105 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     const NumaNodesWeights &numaNodesWeights,
+                                     const NetworkReshaper &reshaper,
+                                     const MKLDNNGraphPlan::Ptr &plan) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
+    _numaNodesWeights(numaNodesWeights),
+    _reshaper(reshaper),
     _name{network.getName()} {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::MKLDNNExecNetwork");
 
+    // blobs are shared between the clones, so keeping the source network costs only its topology
+    if (_cfg.exportableNetwork && !_cfg.dynamicShapes) {
+        _sourceNetwork = cloneNet(network);
+    }
+    _clonedNetwork = PrepareNetwork(network);
+
+    if (_cfg.dynamicShapes) {
+        if (!_reshaper)
+            THROW_IE_EXCEPTION << "Dynamic shapes are supported only for networks represented by ngraph::Function";
+        if (_cfg.enableDynamicBatch)
+            THROW_IE_EXCEPTION << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES << " cannot be used together with "
+                               << PluginConfigParams::KEY_DYN_BATCH_ENABLED;
+    }
+
+    if (_cfg.batchLimit > 1) {
+        // check topology for applicability
+        if (!CanProcessDynBatch(*_clonedNetwork)) {
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
+        }
+    }
+
+    if (cfg.exclusiveAsyncRequests) {
+        // special case when all InferRequests are muxed into a single queue
+        _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
+    } else {
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
+        streamsExecutorConfig._name = "CPUStreamsExecutor";
+        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+    }
+    if (0 != cfg.streamExecutorConfig._streams) {
+        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    } else {
+        _callbackExecutor = _taskExecutor;
+    }
+
+    if (_cfg.pooledWorkspace) {
+        _workspacePool = std::make_shared<MKLDNNWorkspacePool>();
+    }
+
+    if (_cfg.trace) {
+        _tracer = std::make_shared<MKLDNNTracer>();
+    }
+
+    // Exported networks keep the plan for import
+    if (plan) {
+        _plan = plan;
+    } else if (_cfg.streamExecutorConfig._streams != 1 || _sourceNetwork) {
+        _plan = std::make_shared<MKLDNNGraphPlan>();
+    }
+
+    _graphs = decltype(_graphs){[&] {
+        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+        //       is fixed and does not change content of network passed (CVS-26420)
+        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+        return CreateGraph(static_cast<ICNNNetwork&>(*localNetwork));
+    }};
+
+    // The first graph is compiled alone, so graphs of other streams reuse its results
+    if (_plan && !_plan->recorded) {
+        _taskExecutor->runAndWait({[this] {_graphs.local();}});
+    }
+    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+
+    // Save all MemoryLayer data tensors. Will use insight about mechanics
+    // of MemoryLayer implementation. It uses output edge of MemoryLayer
+    // producer as storage for tensor to keep it between infer calls.
+    if (_graphs.size() == 1) {
+        for (auto &node : _graphs.begin()->get()->GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                auto state_store = memoryNode->getStore();
+                auto state_name = node->getName();
+
+                // Remove suffix with pair ID. Internal information.
+                auto suffix_idx = state_name.find("/id=");
+                if (suffix_idx != std::string::npos)
+                    state_name = state_name.substr(0, suffix_idx);
+
+                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
+            }
+        }
+    }
+}
+
+CNNNetworkImplPtr MKLDNNExecNetwork::PrepareNetwork(const InferenceEngine::ICNNNetwork &network) {
     // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    auto clonedNetwork = cloneNet(network);
 
     if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
 #ifdef USE_CNNNETWORK_LPT
@@ -69,7 +165,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
             remove("ScaleShift").
             remove("Power"));
-        transformer.transform(*_clonedNetwork);
+        transformer.transform(*clonedNetwork);
 #endif
 
         // Check if network is INT8 or Binary.
@@ -87,20 +183,20 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
         if (with_cpu_x86_bfloat16() && isFloatModel) {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(clonedNetwork);
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-            if (cfg.enforceBF16 == true)
+            if (_cfg.enforceBF16 == true)
                 bf16Transformer.convertToBFloat16(cnnetwork);
         } else {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(clonedNetwork);
             bf16Transformer.convertToFloat(cnnetwork);
         }
     }
 
-    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*clonedNetwork));
 
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, std::string name) {
         LayerParams attrs = {layer.get()->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
@@ -119,9 +215,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         getCreatorLayer(newEdgeAfterLayer) = constLayer;
         getInputTo(newEdgeAfterLayer).clear();
 
-        _clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
+        clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
         IE_SUPPRESS_DEPRECATED_START
-        _clonedNetwork->addLayer(constLayer);
+        clonedNetwork->addLayer(constLayer);
         IE_SUPPRESS_DEPRECATED_END
 
         constLayer->outData.push_back(newEdgeAfterLayer);
@@ -129,7 +225,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         layer->insData.push_back(newEdgeAfterLayer);
     };
 
-    auto all_layers = details::CNNNetSortTopologically(*_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(*clonedNetwork);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             Blob::Ptr scalesBlob = layer->blobs["weights"];
@@ -155,67 +251,70 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
-    if (_cfg.batchLimit > 1) {
-        // check topology for applicability
-        if (!CanProcessDynBatch(*_clonedNetwork)) {
-            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: such topology cannot be compiled for dynamic batch!";
-        }
-    }
+    return clonedNetwork;
+}
 
-    if (cfg.exclusiveAsyncRequests) {
-        // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
-    } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(const InferenceEngine::ICNNNetwork &network, const ShapeGraphs::Ptr &shapeGraphs) {
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
-            IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
-    } else {
-        _callbackExecutor = _taskExecutor;
+    graph->workspacePool = _workspacePool;
+    graph->tracer = _tracer;
+    // Recorded compilation results are valid for the input shapes they were recorded for only
+    graph->plan = shapeGraphs ? shapeGraphs->plan : _plan;
+    int numaNode = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+        graph->traceStreamId = streamExecutor->GetStreamId();
     }
+    // Reordered weights depend on the layouts chosen for the input shapes, so they are shared between graphs
+    // of the same shapes only
+    graph->CreateGraph(network, extensionManager, shapeGraphs ? shapeGraphs->weightsSharing : _numaNodesWeights[numaNode]);
+    return graph;
+}
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
-        }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
-    }};
-
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const InferenceEngine::ICNNNetwork::InputShapes &shapes) {
+    if (!_reshaper)
+        THROW_IE_EXCEPTION << "Dynamic shapes are not enabled. Set " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES << " to YES";
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = node->getName();
+    ShapeGraphs::Ptr shapeGraphs;
+    {
+        std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+        auto it = std::find_if(_shapeGraphs.begin(), _shapeGraphs.end(),
+                               [&](const decltype(_shapeGraphs)::value_type &entry) { return entry.first == shapes; });
+        if (it != _shapeGraphs.end()) {
+            _shapeGraphs.splice(_shapeGraphs.begin(), _shapeGraphs, it);
+        } else {
+            _shapeGraphs.emplace_front(shapes, std::make_shared<ShapeGraphs>());
+            if (_cfg.streamExecutorConfig._streams != 1)
+                _shapeGraphs.front().second->plan = std::make_shared<MKLDNNGraphPlan>();
+            if (_shapeGraphs.size() > shapeGraphsCapacity)
+                _shapeGraphs.pop_back();
+        }
+        shapeGraphs = _shapeGraphs.front().second;
+    }
 
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+    auto &graph = shapeGraphs->graphs.local();
+    if (graph)
+        return graph;
 
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
-            }
-        }
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetGraph");
+    // The first graph of the shapes is compiled alone, so graphs of other streams reuse its results
+    std::unique_lock<std::mutex> lock{shapeGraphs->mutex};
+    if (!shapeGraphs->network) {
+        // The source network is shared by all shapes
+        std::lock_guard<std::mutex> reshaperLock{_reshaperMutex};
+        shapeGraphs->network = PrepareNetwork(*_reshaper(shapes));
     }
+    auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*shapeGraphs->network));
+    if (!shapeGraphs->plan || shapeGraphs->plan->recorded)
+        lock.unlock();
+
+    graph = CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), shapeGraphs);
+    return graph;
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -226,6 +325,13 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     for (auto g : _graphs) {
         g->setProperty(properties);
     }
+    std::lock_guard<std::mutex> lock{_shapeGraphsMutex};
+    for (auto &shapeGraphs : _shapeGraphs) {
+        for (auto &graph : shapeGraphs.second->graphs) {
+            if (graph)
+                graph->setProperty(properties);
+        }
+    }
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
@@ -263,6 +369,11 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_WORKSPACE_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_WORKSPACE_EFFICIENCY));
+        metrics.push_back(METRIC_KEY(CPU_APPLIED_FUSIONS));
+        metrics.push_back(METRIC_KEY(CPU_PERF_HISTOGRAMS));
+        metrics.push_back(METRIC_KEY(CPU_TRACE));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -277,6 +388,37 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_WORKSPACE_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_WORKSPACE_SIZE, static_cast<uint64_t>(_graphs.begin()->get()->GetWorkspaceSize()));
+    } else if (name == METRIC_KEY(CPU_WORKSPACE_EFFICIENCY)) {
+        auto graph = _graphs.begin()->get();
+        auto lowerBound = graph->GetWorkspaceLowerBound();
+        IE_SET_METRIC_RETURN(CPU_WORKSPACE_EFFICIENCY, lowerBound == 0 ? 1.0f :
+            static_cast<float>(graph->GetWorkspaceSize()) / static_cast<float>(lowerBound));
+    } else if (name == METRIC_KEY(CPU_APPLIED_FUSIONS)) {
+        std::map<std::string, uint64_t> fusions;
+        for (auto &&fusion : _graphs.begin()->get()->GetAppliedFusions()) {
+            fusions[fusion.first] = fusion.second;
+        }
+        IE_SET_METRIC_RETURN(CPU_APPLIED_FUSIONS, fusions);
+    } else if (name == METRIC_KEY(CPU_PERF_HISTOGRAMS)) {
+        std::stringstream json;
+        json << "{\"streams\":[";
+        size_t stream = 0;
+        for (auto &&graph : _graphs) {
+            json << (stream == 0 ? "" : ",") << "{\"stream\":" << stream << ",\"nodes\":";
+            graph->DumpPerfHistograms(json);
+            json << "}";
+            stream++;
+        }
+        json << "]}";
+        IE_SET_METRIC_RETURN(CPU_PERF_HISTOGRAMS, json.str());
+    } else if (name == METRIC_KEY(CPU_TRACE)) {
+        if (!_tracer)
+            THROW_IE_EXCEPTION << "Tracing is not enabled. Set " << CPUConfigParams::KEY_CPU_TRACE << " to YES";
+        std::stringstream json;
+        _tracer->writeChromeTrace(json);
+        IE_SET_METRIC_RETURN(CPU_TRACE, json.str());
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -339,3 +481,112 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
 std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
     return memoryStates;
 }
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+
+    // Import does not restore the reshaper needed to compile the network for other input shapes
+    if (_cfg.dynamicShapes) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks loaded with "
+                           << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES << " enabled is not supported";
+    }
+
+    if (!_sourceNetwork) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export is supported only for networks loaded with "
+                           << PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK << " enabled";
+    }
+
+    // TensorIterator body is not a part of IR v7 serialization
+    CNNNetworkIterator itLayer(_sourceNetwork.get());
+    for (; itLayer != CNNNetworkIterator(); itLayer++) {
+        if (CaselessEq<std::string>()((*itLayer)->type, "TensorIterator")) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with TensorIterator layer is not supported";
+        }
+    }
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        const auto& preProcess = networkInput.second->getPreProcess();
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+        inputNode.append_attribute("resize-algorithm").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        inputNode.append_attribute("color-format").set_value(static_cast<int>(preProcess.getColorFormat()));
+        inputNode.append_attribute("letterbox").set_value(preProcess.getLetterbox());
+        inputNode.append_attribute("pad-value").set_value(preProcess.getPadValue());
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto creator = getCreatorLayer(networkOutput.second).lock();
+        if (!creator) {
+            THROW_IE_EXCEPTION << "Output " << networkOutput.first << " has no creator layer";
+        }
+        auto index = std::distance(creator->outData.begin(),
+            std::find_if(creator->outData.begin(), creator->outData.end(), [&] (const DataPtr& data) {
+                return data->getName() == networkOutput.first;
+            }));
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("creatorName").set_value(creator->name.c_str());
+        outputNode.append_attribute("index").set_value(static_cast<unsigned long long>(index));
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    // Compilation results of the first graph, import validates them against its own graphs
+    if (_plan && _plan->recorded) {
+        auto planNode = cpuNode.append_child("plan");
+        planNode.append_attribute("workspace-size").set_value(static_cast<long long>(_plan->workspaceSize));
+        planNode.append_attribute("workspace-lower-bound").set_value(static_cast<long long>(_plan->workspaceLowerBound));
+        auto descriptorsNode = planNode.append_child("descriptors");
+        for (auto&& descriptor : _plan->selectedDescriptors) {
+            auto descriptorNode = descriptorsNode.append_child("descriptor");
+            descriptorNode.append_attribute("node").set_value(descriptor.first.c_str());
+            descriptorNode.append_attribute("index").set_value(descriptor.second.index);
+            descriptorNode.append_attribute("supported").set_value(static_cast<unsigned long long>(descriptor.second.supportedCount));
+            descriptorNode.append_attribute("impl-type").set_value(static_cast<int>(descriptor.second.implType));
+        }
+        auto boxesNode = planNode.append_child("boxes");
+        for (size_t i = 0; i < _plan->boxes.size(); i++) {
+            const auto& box = _plan->boxes[i];
+            auto boxNode = boxesNode.append_child("box");
+            boxNode.append_attribute("start").set_value(box.start);
+            boxNode.append_attribute("finish").set_value(box.finish);
+            boxNode.append_attribute("size").set_value(static_cast<long long>(box.size));
+            boxNode.append_attribute("id").set_value(static_cast<long long>(box.id));
+            boxNode.append_attribute("offset").set_value(static_cast<long long>(_plan->offsets[i]));
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    // IR xml and weights are stored as size-prefixed sections
+    std::stringstream xmlStream, binStream;
+    Serialization::Serialize(xmlStream, binStream, *_sourceNetwork);
+    for (auto stream : {&xmlStream, &binStream}) {
+        auto dataSize = static_cast<std::uint64_t>(stream->tellp());
+        networkModel.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+        if (0 != dataSize) {
+            networkModel << stream->rdbuf();
+        }
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error during CPU network export";
+    }
+}
@@ -10,6 +10,8 @@
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <functional>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
@@ -29,8 +31,18 @@ public:
 
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
+    /**
+     * Creates a network with the given input shapes from the network passed to the plugin
+     */
+    typedef std::function<std::shared_ptr<InferenceEngine::ICNNNetwork>(const InferenceEngine::ICNNNetwork::InputShapes&)>
+        NetworkReshaper;
+
+    /**
+     * The recorded plan is passed for imported networks, so their graphs skip the same search as at export
+     */
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, const NumaNodesWeights &weightsSharing,
+                      const NetworkReshaper &reshaper = {}, const MKLDNNGraphPlan::Ptr &plan = nullptr);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -44,18 +56,55 @@ public:
 
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    /**
+     * Returns a graph of the current stream compiled for the given input shapes.
+     * Graphs are compiled on the first use of the shapes by a stream. Graphs of all streams for the same shapes
+     * share the reshaped network, the compilation plan and the weights, and are kept for a few most recently
+     * used shapes.
+     */
+    MKLDNNGraph::Ptr GetGraph(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
+    void ExportImpl(std::ostream& networkModel) override;
+
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+    // network as it was passed by the plugin, i.e. after common transformations.
+    // Used by Export, so it is kept only for networks loaded with EXPORTABLE_NETWORK
+    InferenceEngine::details::CNNNetworkImplPtr _sourceNetwork;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    MKLDNNWorkspacePool::Ptr                    _workspacePool;
+    MKLDNNTracer::Ptr                           _tracer;
+    MKLDNNGraphPlan::Ptr                        _plan;
+    // A copy of the plugin weights caches: graphs created later still share weights with other networks,
+    // but the network does not refer to the plugin
+    NumaNodesWeights                            _numaNodesWeights;
+    NetworkReshaper                             _reshaper;
+    std::mutex                                  _reshaperMutex;
+    // Graphs of all streams compiled for input shapes different from the network ones
+    struct ShapeGraphs {
+        typedef std::shared_ptr<ShapeGraphs> Ptr;
+
+        std::mutex                                      mutex;
+        InferenceEngine::details::CNNNetworkImplPtr     network;
+        MKLDNNGraphPlan::Ptr                            plan;
+        MKLDNNWeightsSharing::Ptr                       weightsSharing = std::make_shared<MKLDNNWeightsSharing>();
+        InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  graphs;
+    };
+    // The most recently used shapes first
+    std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes, ShapeGraphs::Ptr>> _shapeGraphs;
+    std::mutex                                  _shapeGraphsMutex;
+    static constexpr size_t                     shapeGraphsCapacity = 8;
     std::string                                 _name;
 
+    InferenceEngine::details::CNNNetworkImplPtr PrepareNetwork(const InferenceEngine::ICNNNetwork &network);
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::ICNNNetwork &network, const ShapeGraphs::Ptr &shapeGraphs = nullptr);
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
 };
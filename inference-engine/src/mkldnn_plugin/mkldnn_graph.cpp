@@ -12,6 +12,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <atomic>
+#include <set>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -19,6 +21,7 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_layout_planner.hpp"
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
@@ -35,6 +38,11 @@
 #include <ie_plugin_config.hpp>
 
 #include "utils/blob_dump.h"
+#include "utils/json_utils.h"
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
 
 /*****************************************************
  * Debug capability
@@ -328,7 +336,9 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
 }
 
 void MKLDNNGraph::InitGraph() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitGraph");
     MKLDNNGraphOptimizer optimizer;
+    recordingPlan = plan && !plan->recorded;
 
     SortTopologically();
     InitNodes();
@@ -340,6 +350,7 @@ void MKLDNNGraph::InitGraph() {
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
+    InitInputLayouts();
     InitEdges();
 
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
@@ -403,6 +414,31 @@ void MKLDNNGraph::InitGraph() {
             continue;
         graphNode->execute(stream);
     }
+
+    if (workspacePool)
+        InitWorkspaceBindings();
+
+    if (config.collectPerfCounters) {
+        for (auto &graphNode : graphNodes) {
+            graphNode->PerfCounter().enableHistogram();
+        }
+    }
+
+    if (tracer)
+        InitTraceNames();
+
+    if (recordingPlan) {
+        plan->recorded = true;
+        recordingPlan = false;
+    }
+}
+
+void MKLDNNGraph::InitTraceNames() {
+    traceInferNameId = tracer->registerName(_name, "Inference");
+    traceNodeNameIds.clear();
+    for (auto &graphNode : graphNodes) {
+        traceNodeNameIds.push_back(tracer->registerName(graphNode->getName(), graphNode->getTypeStr()));
+    }
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -412,6 +448,7 @@ void MKLDNNGraph::InitNodes() {
 }
 
 void MKLDNNGraph::InitDescriptors() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitDescriptors");
     for (auto &node : graphNodes) {
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
@@ -426,9 +463,97 @@ void MKLDNNGraph::InitDescriptors() {
         node->filterSupportedPrimitiveDescriptors();
     }
 
+    if (SelectPlannedDescriptors())
+        return;
+
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    if (config.layoutPlanner)
+        MKLDNNLayoutPlanner(graphNodes).plan();
+
+    if (recordingPlan) {
+        for (auto &node : graphNodes) {
+            auto *selectedPD = node->getSelectedPrimitiveDescriptor();
+            plan->selectedDescriptors[node->getName()] = {node->selectedPrimitiveDescriptorIndex,
+                                                          node->getSupportedPrimitiveDescriptors().size(),
+                                                          selectedPD ? selectedPD->getImplementationType() : impl_desc_type::unknown};
+        }
+    }
+}
+
+bool MKLDNNGraph::SelectPlannedDescriptors() {
+    if (!plan || !plan->recorded || plan->selectedDescriptors.size() != graphNodes.size())
+        return false;
+
+    // Nodes are created from the same network, so they have the same names and supported descriptors,
+    // unless the plan was imported from a machine with other instruction sets
+    std::vector<int> selected;
+    selected.reserve(graphNodes.size());
+    for (auto &node : graphNodes) {
+        auto planned = plan->selectedDescriptors.find(node->getName());
+        if (planned == plan->selectedDescriptors.end())
+            return false;
+        const auto &supportedPDs = node->getSupportedPrimitiveDescriptors();
+        const auto &descriptor = planned->second;
+        if (descriptor.supportedCount != supportedPDs.size() || descriptor.index >= static_cast<int>(supportedPDs.size()) ||
+                (descriptor.index >= 0 && supportedPDs[descriptor.index].getImplementationType() != descriptor.implType))
+            return false;
+        selected.push_back(descriptor.index);
+    }
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        graphNodes[i]->selectPrimitiveDescriptorByIndex(selected[i]);
+    }
+    return true;
+}
+
+void MKLDNNGraph::InitInputLayouts() {
+    // Inputs with mean image are filled from the user blob by the fused conversion kernel,
+    // so they can produce the format expected by consumers without a separate reorder
+    for (auto &input : inputNodes) {
+        if (_meanImages.find(input.first) == _meanImages.end())
+            continue;
+
+        auto &node = input.second;
+        auto *selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (selectedPD == nullptr || selectedPD->getConfig().outConfs.size() != 1 || node->getChildEdges().empty())
+            continue;
+
+        auto &outDesc = selectedPD->getConfig().outConfs[0].desc;
+        InferenceEngine::TensorDesc consumersDesc;
+        bool sameDesc = true;
+        for (size_t i = 0; i < node->getChildEdges().size() && sameDesc; i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto *childPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+            int outputNum = edge->getOutputNum();
+            if (childPD == nullptr || outputNum < 0 || outputNum >= childPD->getConfig().inConfs.size()) {
+                sameDesc = false;
+                break;
+            }
+
+            const auto &childDesc = childPD->getConfig().inConfs[outputNum].desc;
+            // BF16 consumers of FP32 inputs take the rounded values straight from the conversion kernel
+            if (childDesc.getLayout() == InferenceEngine::Layout::ANY ||
+                (childDesc.getPrecision() != outDesc.getPrecision() &&
+                 (outDesc.getPrecision() != InferenceEngine::Precision::FP32 ||
+                  !MeanImage::IsOutputPrecisionSupported(childDesc.getPrecision()))) ||
+                childDesc.getDims() != outDesc.getDims() ||
+                !MeanImage::IsOutputFormatSupported(MKLDNNMemoryDesc(childDesc).getFormat())) {
+                sameDesc = false;
+            } else if (i == 0) {
+                consumersDesc = childDesc;
+            } else {
+                sameDesc = MKLDNNExtensionUtils::initTensorsAreEqual(consumersDesc, childDesc);
+            }
+        }
+
+        if (sameDesc && !MKLDNNExtensionUtils::initTensorsAreEqual(outDesc, consumersDesc)) {
+            outDesc = consumersDesc;
+            selectedPD->setOutputLayouts(MKLDNNMemoryDesc(consumersDesc).getFormat());
+        }
+    }
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -516,7 +641,112 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+/**
+ * For each node returns the max execution index of a node which is not its descendant
+ * in the dependency graph. All nodes placed after this index start only when the node is done.
+ */
+static std::vector<int> getLastIndependentIndexes(const std::vector<std::vector<size_t>> &successors) {
+    const size_t nodesNum = successors.size();
+    std::vector<std::vector<bool>> descendants(nodesNum, std::vector<bool>(nodesNum, false));
+    for (size_t i = nodesNum; i-- > 0;) {
+        for (auto succ : successors[i]) {
+            descendants[i][succ] = true;
+            for (size_t j = succ + 1; j < nodesNum; j++)
+                if (descendants[succ][j]) descendants[i][j] = true;
+        }
+    }
+
+    std::vector<int> lastIndependent(nodesNum);
+    for (size_t i = 0; i < nodesNum; i++) {
+        size_t last = nodesNum - 1;
+        while (last > i && descendants[i][last]) last--;
+        lastIndependent[i] = static_cast<int>(last);
+    }
+    return lastIndependent;
+}
+
+bool MKLDNNGraph::CanExecuteInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return false;
+
+    // Memory nodes and TensorIterator rely on the sequential order of their side effects
+    for (auto &node : graphNodes) {
+        auto type = node->getType();
+        if (type == MemoryInput || type == MemoryOutput || type == TensorIterator)
+            return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void MKLDNNGraph::InitExecDependencies(const std::vector<std::vector<MKLDNNEdgePtr>> &edgeClusters) {
+    const size_t nodesNum = graphNodes.size();
+    std::vector<std::set<size_t>> successors(nodesNum);
+
+    // Dependencies always go along the execution order, so the result is acyclic
+    auto addDependency = [&](int from, int to) {
+        if (from < to)
+            successors[from].insert(to);
+        else if (to < from)
+            successors[to].insert(from);
+    };
+
+    for (auto &edge : graphEdges)
+        addDependency(edge->getParent()->execIndex, edge->getChild()->execIndex);
+
+    // A node computing in-place modifies memory which is visible through the other edges
+    // of the cluster. Keep all accesses to such memory in the original execution order.
+    auto isView = [](const MKLDNNNodePtr &node) {
+        auto type = node->getType();
+        return type == Input || type == Output || type == Reshape || type == Flatten ||
+               type == Split || type == Concatenation;
+    };
+    for (auto &cluster : edgeClusters) {
+        std::set<int> accessors, writers;
+        for (auto &edge : cluster) {
+            accessors.insert(edge->getParent()->execIndex);
+            accessors.insert(edge->getChild()->execIndex);
+        }
+        for (auto &edge : cluster) {
+            auto child = edge->getChild();
+            if (isView(child))
+                continue;
+            for (auto &peer : cluster) {
+                if (peer->getParent() == child) {
+                    writers.insert(child->execIndex);
+                    break;
+                }
+            }
+        }
+        for (auto writer : writers)
+            for (auto accessor : accessors)
+                addDependency(accessor, writer);
+    }
+
+    execSuccessors.assign(nodesNum, {});
+    execPredecessorsNum.assign(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; i++) {
+        execSuccessors[i].assign(successors[i].begin(), successors[i].end());
+        for (auto succ : successors[i])
+            execPredecessorsNum[succ]++;
+    }
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::AllocateWithReuse");
+    // Memory layers keep data in edges between inferences, so such graphs cannot lease a workspace
+    if (workspacePool) {
+        for (auto &node : graphNodes) {
+            if (node->getType() == MemoryInput || node->getType() == MemoryOutput) {
+                workspacePool.reset();
+                break;
+            }
+        }
+    }
+
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
     // detect edge clusters which are view on one.
@@ -584,15 +814,29 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
+    // In dataflow mode a memory can be reused only by nodes which depend on all consumers of the
+    // previous data. So life time of data is extended up to the last node which may run concurrently
+    // with any of its consumers.
+    std::vector<int> lastIndependent;
+    execSuccessors.clear();
+    execPredecessorsNum.clear();
+    if (CanExecuteInParallel()) {
+        InitExecDependencies(edge_clasters);
+        lastIndependent = getLastIndependentIndexes(execSuccessors);
+    }
+
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    std::vector<bool> allocate_separately(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            if (!lastIndependent.empty())
+                e_finish = lastIndependent[e_finish];
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -637,10 +881,38 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
 
         box.size = div_up(box.size, alignment);
+
+        // Pooled workspace does not keep data between inferences, so constants are allocated separately
+        if (workspacePool && isConst) {
+            allocate_separately[i] = true;
+            box.size = 0;
+        }
+    }
+
+    std::vector<int64_t> offsets(boxes.size());
+    int64_t required = 0, lowerBound = 0;
+    if (plan && plan->recorded && MKLDNNGraphPlan::equal(plan->boxes, boxes)) {
+        offsets = plan->offsets;
+        required = plan->workspaceSize;
+        lowerBound = plan->workspaceLowerBound;
+    } else {
+        MemorySolver memSolver(boxes);
+        required = memSolver.solve();
+        lowerBound = memSolver.maxDepth();
+        for (int i = 0; i < boxes.size(); i++)
+            offsets[i] = memSolver.getOffset(i);
+
+        if (recordingPlan) {
+            plan->boxes = boxes;
+            plan->offsets = offsets;
+            plan->workspaceSize = required;
+            plan->workspaceLowerBound = lowerBound;
+        }
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    size_t total_size = static_cast<size_t>(required) * alignment;
+    workspaceSize = total_size;
+    workspaceLowerBound = static_cast<size_t>(std::max<int64_t>(lowerBound, 0)) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -650,10 +922,13 @@ void MKLDNNGraph::AllocateWithReuse() {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = offsets[i];
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                if (allocate_separately[i])
+                    edge->allocate();
+                else
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -668,6 +943,49 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::InitWorkspaceBindings() {
+    workspaceBindings.clear();
+    if (workspaceSize == 0) {
+        workspacePool.reset();
+        return;
+    }
+
+    // Edges which are views on other ones (in-place nodes) have own memory objects,
+    // so all memory objects pointing into the workspace are collected
+    auto *begin = static_cast<uint8_t *>(memWorkspace->GetPrimitive().get_data_handle());
+    auto *end = begin + workspaceSize;
+    for (auto &edge : graphEdges) {
+        auto &memory = edge->getMemoryPtr();
+        if (!memory || !memory->GetPrimitivePtr())
+            continue;
+        auto *ptr = static_cast<uint8_t *>(memory->GetPrimitive().get_data_handle());
+        if (ptr >= begin && ptr < end)
+            workspaceBindings.emplace_back(memory, ptr - begin);
+    }
+
+    // The workspace used for graph initialization is not needed anymore
+    memWorkspace.reset();
+}
+
+void MKLDNNGraph::LeaseWorkspace() {
+    if (!workspacePool)
+        return;
+
+    memWorkspace = workspacePool->acquire(workspaceSize, eng);
+    auto *begin = static_cast<uint8_t *>(memWorkspace->GetPrimitive().get_data_handle());
+    // Pointers are always updated as input and output edges may point to user blobs after previous inference
+    for (auto &binding : workspaceBindings)
+        binding.first->GetPrimitivePtr()->set_data_handle(begin + binding.second);
+}
+
+void MKLDNNGraph::ReturnWorkspace() {
+    if (!workspacePool || !memWorkspace)
+        return;
+
+    workspacePool->release(memWorkspace);
+    memWorkspace.reset();
+}
+
 void MKLDNNGraph::Allocate() {
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
@@ -691,33 +1009,50 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+Blob::Ptr MKLDNNGraph::getNormalizedInputMemory(const std::string& name) {
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end() || _meanImages.find(name) == _meanImages.end())
+        return nullptr;
+
+    auto &inputMemory = input->second->getChildEdgeAt(0)->getMemory();
+    const auto format = inputMemory.GetFormat();
+    if (inputMemory.GetDataType() != mkldnn::memory::f32 ||
+            (format != mkldnn::memory::nchw && format != mkldnn::memory::nhwc) ||
+            inputMemory.GetDescriptor().data.layout_desc.blocking.offset_padding != 0)
+        return nullptr;
+
+    TensorDesc desc(Precision::FP32, input->second->getChildEdgeAt(0)->getDims().ToSizeVector(),
+                    format == mkldnn::memory::nchw ? NCHW : NHWC);
+    return make_shared_blob<float>(desc, reinterpret_cast<float *>(inputMemory.GetData()));
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
+        auto &inputMemory = input->second->getChildEdgeAt(0)->getMemory();
 
-        const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
+        auto l = in->getTensorDesc().getLayout();
+        if (l == CHW && outDims.ndims() == 4)
+            l = NCHW;
 
-        if (ext_data_ptr != inter_data_ptr) {
-            auto l = in->getTensorDesc().getLayout();
-            if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
-                l = NCHW;
-
-            input->second->getChildEdgeAt(0)->getMemory().SetData(
-                    MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                    MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
+        auto meanImage = _meanImages.find(name);
+        if (meanImage != _meanImages.end()) {
+            // precision conversion, mean subtraction and reorder are done in a single pass over the user data
+            meanImage->second.SubtractConvert(outDims, in, l, inputMemory);
+            return;
         }
 
-        // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
-            } else {
-                THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
-            }
+        const void *ext_data_ptr = in->cbuffer();
+        void *inter_data_ptr = inputMemory.GetData();
+
+        if (ext_data_ptr != inter_data_ptr) {
+            inputMemory.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
+                                MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
         }
     } else {
         THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
@@ -774,31 +1109,90 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
-void MKLDNNGraph::Infer(int batch) {
+void MKLDNNGraph::Infer(int batch, int requestId) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    if (!execSuccessors.empty()) {
+        if (batch > 0) {
+            for (auto &node : graphNodes)
+                node->setDynamicBatchLim(batch);
+        }
+        InferDataflow(requestId);
+    } else {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            PERF(graphNodes[i]);
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            if (batch > 0)
+                graphNodes[i]->setDynamicBatchLim(batch);
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
-            graphNodes[i]->execute(stream);
-        }
+            if (!graphNodes[i]->isConstant()) {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
+                MKLDNNTraceScope traceScope(tracer.get(), tracer ? traceNodeNameIds[i] : 0, traceStreamId, requestId);
+                graphNodes[i]->execute(stream);
+            }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+            ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        }
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InferDataflow(int requestId) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const size_t nodesNum = graphNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> pending(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; i++)
+        pending[i] = execPredecessorsNum[i];
+
+    // Tasks are spawned into the arena of the current stream, so nested parallel_for calls
+    // of the nodes share the same threads.
+    tbb::task_group taskGroup;
+    std::function<void(size_t)> executeFrom = [&](size_t idx) {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        // Follow the chain in the current thread and spawn tasks only for the extra ready branches
+        while (idx < nodesNum) {
+            const MKLDNNNodePtr &node = graphNodes[idx];
+            {
+                PERF(node);
+                ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+                if (!node->isConstant()) {
+                    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profilingTask);
+                    MKLDNNTraceScope traceScope(tracer.get(), tracer ? traceNodeNameIds[idx] : 0, traceStreamId, requestId);
+                    node->execute(stream);
+                }
+
+                ENABLE_DUMP(do_after(DUMP_DIR, node));
+            }
+
+            size_t next = nodesNum;
+            for (auto succ : execSuccessors[idx]) {
+                if (--pending[succ] == 0) {
+                    if (next < nodesNum)
+                        taskGroup.run([&executeFrom, next] { executeFrom(next); });
+                    next = succ;
+                }
+            }
+            idx = next;
+        }
+    };
+
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (execPredecessorsNum[i] == 0)
+            taskGroup.run([&executeFrom, i] { executeFrom(i); });
+    }
+    taskGroup.wait();
+#else
+    THROW_IE_EXCEPTION << "Dataflow execution is supported only with TBB threading";
+#endif
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -915,6 +1309,29 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::DumpPerfHistograms(std::ostream &out) const {
+    out << "[";
+    bool first = true;
+    for (auto &node : graphNodes) {
+        auto &counter = node->PerfCounter();
+        if (node->isConstant() || !counter.hasHistogram() || counter.count() == 0)
+            continue;
+
+        out << (first ? "" : ",")
+            << "{\"name\":\"" << escapeJson(node->getName())
+            << "\",\"type\":\"" << escapeJson(node->getTypeStr())
+            << "\",\"exec_type\":\"" << escapeJson(node->getPrimitiveDescriptorType())
+            << "\",\"count\":" << counter.count()
+            << ",\"avg_us\":" << counter.avg()
+            << ",\"p50_us\":" << counter.percentile(0.5)
+            << ",\"p90_us\":" << counter.percentile(0.9)
+            << ",\"p99_us\":" << counter.percentile(0.99)
+            << ",\"max_us\":" << counter.max() << "}";
+        first = false;
+    }
+    out << "]";
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -927,6 +1344,22 @@ Config MKLDNNGraph::getProperty() {
     return config;
 }
 
+std::map<std::string, size_t> MKLDNNGraph::GetAppliedFusions() const {
+    std::map<std::string, size_t> fusions;
+    for (auto &node : graphNodes) {
+        auto &fusedWith = node->getFusedWith();
+        if (fusedWith.empty())
+            continue;
+
+        std::string pattern = node->getTypeStr();
+        for (auto &fusedNode : fusedWith) {
+            pattern += "+" + fusedNode->getTypeStr();
+        }
+        fusions[pattern]++;
+    }
+    return fusions;
+}
+
 void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
     for (auto &it : inputNodes) {
@@ -11,11 +11,15 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_workspace_pool.hpp"
+#include "mkldnn_tracer.hpp"
+#include "mkldnn_graph_plan.hpp"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <ostream>
 
 namespace MKLDNNPlugin {
 
@@ -23,6 +27,13 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    // If set, intermediate tensors are placed into a workspace leased from the pool for the time of inference
+    MKLDNNWorkspacePool::Ptr workspacePool;
+    // If set, execution of the nodes is recorded to the tracer. Should be set before the graph creation
+    MKLDNNTracer::Ptr tracer;
+    int traceStreamId = 0;
+    // If set, stream independent compilation results are taken from the plan or recorded into it if it is empty
+    MKLDNNGraphPlan::Ptr plan;
 
     enum Status {
         NotReady = 0,
@@ -55,10 +66,16 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
+    /**
+     * Returns FP32 blob over the memory of the input with mean values if the memory has a plain layout,
+     * so that pre-processing fills it with normalized data instead of PushInputData(), nullptr otherwise
+     */
+    InferenceEngine::Blob::Ptr getNormalizedInputMemory(const std::string& name);
+
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(int batch = -1);
+    void Infer(int batch = -1, int requestId = -1);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
@@ -80,12 +97,27 @@ public:
         return inputNodes;
     }
 
+    // Size in bytes of the memory shared by intermediate tensors
+    size_t GetWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    // Minimal possible size of the workspace for the current execution order:
+    // max total size of tensors alive at the same time
+    size_t GetWorkspaceLowerBound() const {
+        return workspaceLowerBound;
+    }
+
+    // Number of nodes per applied fusion pattern, e.g. "Convolution+ReLU+FakeQuantize"
+    std::map<std::string, size_t> GetAppliedFusions() const;
 
     mkldnn::engine getEngine() const {
         return eng;
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    // Writes latency percentiles of executed nodes as a JSON array, requires collecting of performance counters
+    void DumpPerfHistograms(std::ostream &out) const;
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -101,6 +133,11 @@ public:
 
     void SortTopologically();
 
+    // Take a workspace from the pool and bind intermediate tensors to it. No-op if the pool is not used
+    void LeaseWorkspace();
+    // Return the leased workspace back to the pool
+    void ReturnWorkspace();
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -123,7 +160,22 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    // The graph fills the plan during its initialization
+    bool recordingPlan = false;
+
     MKLDNNMemoryPtr memWorkspace;
+    size_t workspaceSize = 0;
+    size_t workspaceLowerBound = 0;
+    // Memory objects placed in the pooled workspace and their offsets from the workspace begin
+    std::vector<std::pair<MKLDNNMemoryPtr, ptrdiff_t>> workspaceBindings;
+
+    // Dataflow execution state (see Config::parallelBranches). Indexes are positions in graphNodes.
+    std::vector<std::vector<size_t>> execSuccessors;
+    std::vector<size_t> execPredecessorsNum;
+
+    // Tracer name identifiers of graphNodes and of the whole inference
+    std::vector<uint32_t> traceNodeNameIds;
+    uint32_t traceInferNameId = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -140,10 +192,17 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    bool SelectPlannedDescriptors();
+    void InitInputLayouts();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitWorkspaceBindings();
     void CreatePrimitives();
+    bool CanExecuteInParallel() const;
+    void InitExecDependencies(const std::vector<std::vector<MKLDNNEdgePtr>> &edgeClusters);
+    void InferDataflow(int requestId);
+    void InitTraceNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -109,22 +109,7 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     graph.RemoveDroppedNodes();
 #endif
 
-    FuseConvolutionAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseFullyConnectedAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseMVNAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseResampleAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseInterpolateAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseNormalizeAndSimpleOperation(graph);
+    ApplyFusionRules(graph, GetFusionRules());
     graph.RemoveDroppedNodes();
 
     FuseEltwiseAndSimple(graph);
@@ -650,113 +635,6 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndActivation(MKLDNNGraph &graph) {
     }
 }
 
-void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
-    };
-
-    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
-        if (!childNode->getCnnLayer())
-            return false;
-
-        if (childNode->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(childNode.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << childNode->getName();
-
-            if (parentNode->getParentEdgesAtPort(0)[0]->getDims().ndims() != 3) {
-                return !quantizeNode->isBinarization();
-            } else {
-                return (quantizeNode->isInputLowBroadcast() && quantizeNode->isInputHighBroadcast() &&
-                        quantizeNode->isOutputLowBroadcast() && quantizeNode->isOutputHighBroadcast() &&
-                        !quantizeNode->isBinarization());
-            }
-        } else if (childNode->getType() == Eltwise) {
-            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(childNode.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise node " << childNode->getName();
-
-            if (IsOneOf(eltwiseNode->getOpType(), {Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp, Swish, Hswish, Mish,
-                                                   Hsigmoid, Round})) {
-                return true;
-            } else if (IsOneOf(eltwiseNode->getOpType(), {MulAdd, Prelu})) {
-                if (eltwiseNode->getOpType() == MulAdd && eltwiseNode->getCnnLayer()->blobs.size() != 2)
-                    return false;
-
-                if (parentNode->getParentEdgesAtPort(0)[0]->getDims().ndims() != 3) {
-                    return true;
-                } else {
-                    const auto &eltwiseLayer = eltwiseNode->getCnnLayer();
-                    if (eltwiseLayer == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get scale shift layer " << eltwiseNode->getName();
-
-                    if (eltwiseNode->getOpType() != MulAdd)
-                        return false;
-
-                    Blob::Ptr scalesBlob = eltwiseLayer->blobs["weights"];
-                    if (scalesBlob == nullptr)
-                        return false;
-
-                    Blob::Ptr shiftsBlob = eltwiseLayer->blobs["biases"];
-                    if (shiftsBlob == nullptr)
-                        return false;
-
-                    const float *scalesBufferPtr = scalesBlob->buffer().as<float *>();
-                    const float *shiftsBufferPtr = shiftsBlob->buffer().as<float *>();
-
-                    if (scalesBlob->size() != shiftsBlob->size())
-                        return false;
-
-                    for (int i = 1; i < scalesBlob->size(); i++)
-                        if (scalesBufferPtr[0] != scalesBufferPtr[i])
-                            return false;
-
-                    for (int i = 1; i < shiftsBlob->size(); i++)
-                        if (shiftsBufferPtr[0] != shiftsBufferPtr[i])
-                            return false;
-
-                    return true;
-                }
-            }
-        }
-
-        return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(parentNode, childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == FullyConnected)
-                    continue;
-
-                removeEdge(graph, p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
 void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1020,70 +898,6 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndQuantize(MKLDNNGraph &graph) {
     }
 }
 
-void MKLDNNGraphOptimizer::FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Convolution &&
-               node->getChildEdges().size() == 1 &&
-               node->getCnnLayer()->precision == Precision::FP32;
-    };
-
-    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
-
-            return ((eltwiseNode->getOpType() == MulAdd && node->getCnnLayer()->blobs.size() == 2) ||
-                    (eltwiseNode->getOpType() == Prelu) ||
-                    IsOneOf(eltwiseNode->getOpType(), {Relu, Elu, Logistic, BoundedRelu, Clamp, Swish, Hswish, Mish,
-                                                       Hsigmoid, Round}));
-        }
-
-        return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Convolution)
-                    continue;
-
-                removeEdge(graph, p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
 void MKLDNNGraphOptimizer::FuseBinaryConvolutionAndQuantize(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1392,265 +1206,177 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
 }
 #endif
 
-void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableMVN = (node->getType() == MVN) && (node->inDims[0].ndims() == 4 || node->inDims[0].ndims() == 5);
-
-        if (isSutableMVN) {
-            auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
-            if (mvnLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get MVN layer " << node->getName();
-
-            return node->getChildEdges().size() == 1 && mvnLayer->across_channels == 0 && mvnLayer->normalize == 1;
-        } else {
-            return false;
-        }
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
-
-            return ((eltwiseNode->getOpType() == MulAdd) ||
-                    (eltwiseNode->getOpType() == Prelu) ||
-                     eltwiseNode->getOpType() == Relu);
-        }
+namespace {
 
+bool isQuantization(const MKLDNNNodePtr &node) {
+    if (node->getType() != Quantize)
         return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
 
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == MVN)
-                    continue;
-
-                removeEdge(graph, p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
+    auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+    if (quantizeNode == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+    return !quantizeNode->isBinarization();
 }
 
-void MKLDNNGraphOptimizer::FuseResampleAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableResample = (node->getType() == Resample) && (node->inDims[0].ndims() == 4 || node->inDims[0].ndims() == 5);
-
-        if (isSutableResample) {
-            auto *resampleLayer = node->getCnnLayer().get();
-            if (resampleLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Resample layer " << node->getName();
-
-            return node->getChildEdges().size() == 1 && resampleLayer->GetParamAsString("type") == "caffe.ResampleParameter.NEAREST";
-        } else {
-            return false;
-        }
-    };
-
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto *eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise node " << node->getName();
-            return eltwiseNode->getOpType() == Relu ||
-                   eltwiseNode->getOpType() == MulAdd;
-        }
-
+bool isEltwiseOneOf(const MKLDNNNodePtr &node, const std::vector<EltwiseOpType> &ops) {
+    if (node->getType() != Eltwise)
         return false;
-    };
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Resample)
-                    continue;
+    auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(node.get());
+    if (eltwiseNode == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
+    return std::find(ops.begin(), ops.end(), eltwiseNode->getOpType()) != ops.end();
+}
 
-                removeEdge(graph, p_edge);
-            }
-        }
+// ScaleShift with constant weights and biases
+bool isScaleShift(const MKLDNNNodePtr &node) {
+    return isEltwiseOneOf(node, {MulAdd}) && node->getCnnLayer()->blobs.size() == 2;
+}
 
-        graph.DropNode(childNode);
-    }
+bool isSpatialTensor(const MKLDNNNodePtr &node) {
+    const auto ndims = node->getParentEdgeAt(0)->getDims().ndims();
+    return ndims == 4 || ndims == 5;
 }
 
-void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
+bool isPerTensorScaleShift(const MKLDNNNodePtr &node) {
+    Blob::Ptr scalesBlob = node->getCnnLayer()->blobs["weights"];
+    Blob::Ptr shiftsBlob = node->getCnnLayer()->blobs["biases"];
+    if (scalesBlob == nullptr || shiftsBlob == nullptr || scalesBlob->size() != shiftsBlob->size())
+        return false;
 
-    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
-        bool isSuitable = (node->getType() == Interpolate);
-        if (isSuitable) {
-            return node->getChildEdges().size() == 1;
-        } else {
+    const float *scalesBufferPtr = scalesBlob->buffer().as<float *>();
+    const float *shiftsBufferPtr = shiftsBlob->buffer().as<float *>();
+    for (int i = 1; i < scalesBlob->size(); i++)
+        if (scalesBufferPtr[0] != scalesBufferPtr[i] || shiftsBufferPtr[0] != shiftsBufferPtr[i])
             return false;
-        }
-    };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
-        // Avoid cycle dependencies
-        for (auto &childParentEdge : childNode->getParentEdges()) {
-            for (auto &parentParentEdge : parentNode->getParentEdges()) {
-                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
-                    return false;
-            }
-        }
-        if (!childNode->getFusedWith().empty())
-            return false;
-        auto interpolateNode = dynamic_cast<MKLDNNInterpolateNode*>(parentNode.get());
-        return interpolateNode->canFuse(childNode);
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        auto interpolateNode = dynamic_cast<MKLDNNInterpolateNode*>(parentNode.get());
-        if (!isSutableChildNode(parentNode, childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
+    return true;
+}
 
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Interpolate)
-                    continue;
+bool isPerTensorQuantization(const MKLDNNNodePtr &node) {
+    auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+    return quantizeNode != nullptr &&
+           quantizeNode->isInputLowBroadcast() && quantizeNode->isInputHighBroadcast() &&
+           quantizeNode->isOutputLowBroadcast() && quantizeNode->isOutputHighBroadcast();
+}
 
-                removeEdge(graph, p_edge);
+}  // namespace
+
+std::vector<MKLDNNGraphOptimizer::FusionRule> MKLDNNGraphOptimizer::GetFusionRules() {
+    return {
+        {
+            Convolution,
+            [](const MKLDNNNodePtr &node) {
+                return node->getCnnLayer()->precision == Precision::FP32;
+            },
+            [](const MKLDNNNodePtr &, const MKLDNNNodePtr &node) {
+                return isQuantization(node) || isScaleShift(node) ||
+                       isEltwiseOneOf(node, {Prelu, Relu, Elu, Logistic, BoundedRelu, Clamp, Swish, Hswish, Mish,
+                                             Hsigmoid, Round});
             }
-        }
+        },
+        {
+            FullyConnected,
+            nullptr,
+            [](const MKLDNNNodePtr &parent, const MKLDNNNodePtr &node) {
+                // 3D fully connected supports only per tensor post operations
+                const bool is3D = parent->getParentEdgesAtPort(0)[0]->getDims().ndims() == 3;
+                if (isQuantization(node))
+                    return !is3D || isPerTensorQuantization(node);
+                if (isScaleShift(node))
+                    return !is3D || isPerTensorScaleShift(node);
+                return (!is3D && isEltwiseOneOf(node, {Prelu})) ||
+                       isEltwiseOneOf(node, {Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp, Swish, Hswish, Mish,
+                                             Hsigmoid, Round});
+            }
+        },
+        {
+            MVN,
+            [](const MKLDNNNodePtr &node) {
+                if (!isSpatialTensor(node))
+                    return false;
 
-        graph.DropNode(childNode);
-    }
+                auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
+                if (mvnLayer == nullptr)
+                    THROW_IE_EXCEPTION << "Cannot get MVN layer " << node->getName();
+                return mvnLayer->across_channels == 0 && mvnLayer->normalize == 1;
+            },
+            [](const MKLDNNNodePtr &, const MKLDNNNodePtr &node) {
+                return isQuantization(node) || isEltwiseOneOf(node, {MulAdd, Prelu, Relu});
+            }
+        },
+        {
+            Resample,
+            [](const MKLDNNNodePtr &node) {
+                return isSpatialTensor(node) &&
+                       node->getCnnLayer()->GetParamAsString("type") == "caffe.ResampleParameter.NEAREST";
+            },
+            [](const MKLDNNNodePtr &, const MKLDNNNodePtr &node) {
+                return isQuantization(node) || isEltwiseOneOf(node, {Relu, MulAdd});
+            }
+        },
+        {
+            Interpolate,
+            nullptr,
+            [](const MKLDNNNodePtr &parent, const MKLDNNNodePtr &node) {
+                // Avoid cycle dependencies
+                for (auto &childParentEdge : node->getParentEdges()) {
+                    for (auto &parentParentEdge : parent->getParentEdges()) {
+                        if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
+                            return false;
+                    }
+                }
+                auto interpolateNode = dynamic_cast<MKLDNNInterpolateNode*>(parent.get());
+                return node->getFusedWith().empty() && interpolateNode != nullptr && interpolateNode->canFuse(node);
+            }
+        },
+        {
+            Normalize,
+            nullptr,
+            [](const MKLDNNNodePtr &, const MKLDNNNodePtr &node) {
+                return isQuantization(node) || isScaleShift(node) ||
+                       isEltwiseOneOf(node, {Prelu, Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp, Tanh, Swish,
+                                             Hswish, Mish, Hsigmoid, Round, Linear, Abs, Square, Sqrt});
+            }
+        },
+    };
 }
 
-void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
+void MKLDNNGraphOptimizer::ApplyFusionRules(MKLDNNGraph &graph, const std::vector<FusionRule> &rules) {
     auto& graphNodes = graph.GetNodes();
 
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableNormalize = node->getType() == Normalize;
-
-        if (isSutableNormalize) {
-            return node->getChildEdges().size() == 1;
-        } else {
-            return false;
+    auto findRule = [&](const MKLDNNNodePtr &node) -> const FusionRule* {
+        for (auto &rule : rules) {
+            if (rule.parentType == node->getType() && (!rule.isSuitableParent || rule.isSuitableParent(node)))
+                return &rule;
         }
+        return nullptr;
     };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto *eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise node " << node->getName();
-            return IsOneOf(eltwiseNode->getOpType(), {Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp, Tanh, Swish,
-                                                      Hswish, Mish, Hsigmoid, Round, Linear, Abs, Square, Sqrt}) ||
-                    ((eltwiseNode->getOpType() == MulAdd && eltwiseNode->getCnnLayer()->blobs.size() == 2) ||
-                     (eltwiseNode->getOpType() == Prelu));
-        }
-
-        return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
+    for (auto &parentNode : graphNodes) {
+        const FusionRule *rule = findRule(parentNode);
+        if (rule == nullptr)
             continue;
-        }
 
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
+        // the chain of single consumers is fused while the rule accepts them
+        while (parentNode->getChildEdges().size() == 1) {
+            auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+            if (!childNode->getCnnLayer() || !rule->isSuitableChild(parentNode, childNode))
+                break;
 
-        parentNode->fuseWith(childNode);
+            parentNode->fuseWith(childNode);
 
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
             auto parentEdges = childNode->parentEdges;
             for (auto &parentEdge : parentEdges) {
                 auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Normalize)
+                if (p_edge->getParent()->getType() == parentNode->getType())
                     continue;
 
                 removeEdge(graph, p_edge);
             }
-        }
 
-        graph.DropNode(childNode);
+            graph.DropNode(childNode);
+        }
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include "mkldnn_graph.h"
 #include "nodes/mkldnn_eltwise_node.h"
+#include <functional>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -19,13 +20,26 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    /**
+     * Fusion of a node with the chain of its single consumers, which become post operations of the node.
+     * Rules are looked up by the type of the fusing node, the first rule accepting the node is used.
+     */
+    struct FusionRule {
+        Type parentType;
+        // optional, checks if the node of parentType is able to fuse anything
+        std::function<bool(const MKLDNNNodePtr &parent)> isSuitableParent;
+        // checks if the node is able to fuse the consumer taking into account already fused ones
+        std::function<bool(const MKLDNNNodePtr &parent, const MKLDNNNodePtr &child)> isSuitableChild;
+    };
+
+    static std::vector<FusionRule> GetFusionRules();
+    void ApplyFusionRules(MKLDNNGraph &graph, const std::vector<FusionRule> &rules);
+
     void MergeConversions(MKLDNNGraph& graph);
     void MergeGroupConvolution(MKLDNNGraph& graph);
     void MergeTwoEqualScaleShifts(MKLDNNGraph& graph);
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
-    void FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
-    void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
 #if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
     void FuseConvolutionAndQuantize(MKLDNNGraph &graph);
@@ -36,10 +50,6 @@ private:
 #if defined(COMPILED_CPU_MKLDNN_ELTWISE_NODE)
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
 #endif
-    void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
-    void FuseResampleAndSimpleOperation(MKLDNNGraph &graph);
-    void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
-    void FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_memory_solver.hpp"
+#include "mkldnn/iml_type_mapper.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Stream independent results of a graph compilation
+ * The first graph created for a network records them, so graphs of other streams reuse them instead
+ * of repeating the same search. Each reused result is validated against the graph being created and
+ * is recomputed in case of mismatch.
+ *
+ * Only the primitive descriptor selection (with the layout planner) and the MemorySolver search are skipped,
+ * see the MKLDNNGraph::InitDescriptors and MKLDNNGraph::AllocateWithReuse tasks. Graphs of other streams still
+ * create their nodes, apply the graph optimizations and create their primitives.
+ * The plan of an exported network is stored with it, so the imported network reuses it as well.
+ *
+ * Is a thread safe for reading after the recording is finished
+ */
+struct MKLDNNGraphPlan {
+    typedef std::shared_ptr<MKLDNNGraphPlan> Ptr;
+
+    struct SelectedDescriptor {
+        int index;
+        // Number of supported descriptors and the selected implementation, the plan is not valid if they differ
+        size_t supportedCount;
+        impl_desc_type implType;
+    };
+
+    // Selected primitive descriptors per node name
+    std::unordered_map<std::string, SelectedDescriptor> selectedDescriptors;
+
+    // Intermediate tensors placement
+    std::vector<MemorySolver::Box> boxes;
+    std::vector<int64_t> offsets;
+    int64_t workspaceSize = 0;
+    int64_t workspaceLowerBound = 0;
+
+    std::atomic<bool> recorded = {false};
+
+    static bool equal(const std::vector<MemorySolver::Box>& lhs, const std::vector<MemorySolver::Box>& rhs) {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (size_t i = 0; i < lhs.size(); i++) {
+            if (lhs[i].start != rhs[i].start || lhs[i].finish != rhs[i].finish ||
+                    lhs[i].size != rhs[i].size || lhs[i].id != rhs[i].id)
+                return false;
+        }
+        return true;
+    }
+};
+
+}  // namespace MKLDNNPlugin
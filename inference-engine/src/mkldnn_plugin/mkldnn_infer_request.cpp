@@ -11,6 +11,7 @@
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <debug.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
 #include "nodes/common/cpu_convert.h"
@@ -20,8 +21,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
 : InferRequestInternal(networkInputs, networkOutputs)
 , execNetwork(execNetwork_) {
-    auto id = (execNetwork->_numRequests)++;
-    profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
+    requestId = (execNetwork->_numRequests)++;
+    profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(requestId));
 
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -74,13 +75,36 @@ void MKLDNNPlugin::MKLDNNInferRequest::copyConvert(InferenceEngine::Precision co
     pushInput<dst>(input.first, iconv);
 }
 
+namespace {
+
+// Keeps the pooled workspace bound to the graph until the end of inference
+class WorkspaceLease {
+public:
+    explicit WorkspaceLease(MKLDNNPlugin::MKLDNNGraph* graph) : _graph(graph) {
+        _graph->LeaseWorkspace();
+    }
+    ~WorkspaceLease() {
+        _graph->ReturnWorkspace();
+    }
+
+private:
+    MKLDNNPlugin::MKLDNNGraph* _graph;
+};
+
+}  // namespace
+
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
     graph = execNetwork->_graphs.local().get();
+    if (graph->getProperty().dynamicShapes)
+        selectShapeGraph();
+    // Covers inputs and outputs conversions in addition to the graph nodes
+    MKLDNNTraceScope traceScope(graph->tracer.get(), graph->traceInferNameId, graph->traceStreamId, requestId);
+    WorkspaceLease workspaceLease(graph);
     {
-        execDataPreprocessing(_inputs);
+        auto filledInputs = execPreprocessing();
 
         changeDefaultPtr();
 
@@ -91,6 +115,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 THROW_IE_EXCEPTION << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
             }
 
+            if (filledInputs.count(input.first))
+                continue;
+
             InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
@@ -103,27 +130,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                     pushInput<int8_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send I32
-                    copyConvert<int32_t>(InferenceEngine::Precision::I32, input, convertedInputs);
-                    break;
-                case InferenceEngine::Precision::I16:
                     if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        copyConvert<float>(InferenceEngine::Precision::FP32, input, convertedInputs);
+                        // If a mean image exists, the graph converts the blob to FP32 while subtracting the mean
+                        pushInput<uint16_t>(input.first, input.second);
                     } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
+                        // U16 is unsupported by mkldnn, so here we convert the blob and send I32
+                        copyConvert<int32_t>(InferenceEngine::Precision::I32, input, convertedInputs);
                     }
                     break;
+                case InferenceEngine::Precision::I16:
+                    // If a mean image exists, the graph converts the blob to FP32 while subtracting the mean
+                    pushInput<int16_t>(input.first, input.second);
+                    break;
                 case InferenceEngine::Precision::U8:
                 case InferenceEngine::Precision::BOOL:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        copyConvert<float>(InferenceEngine::Precision::FP32, input, convertedInputs);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    // If a mean image exists, the graph converts the blob to FP32 while subtracting the mean
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I64:
                     // I64 is unsupported by mkldnn, so here we convert the blob and send I32
@@ -139,11 +161,35 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         }
     }
 
-    graph->Infer(m_curBatch);
+    graph->Infer(m_curBatch, requestId);
 
     graph->PullOutputData(_outputs);
 }
 
+std::set<std::string> MKLDNNPlugin::MKLDNNInferRequest::execPreprocessing() {
+    std::set<std::string> filledInputs;
+    for (auto& input : _inputs) {
+        auto preProcData = _preProcData.find(input.first);
+        if (preProcData == _preProcData.end())
+            continue;
+
+        const auto& info = _networkInputs[input.first]->getPreProcess();
+        // U8 data is converted to FP32 and normalized by the pre-processing pipeline right into the graph memory,
+        // instead of writing resized U8 data and subtracting the mean in a separate pass
+        if (input.second->getTensorDesc().getPrecision() == InferenceEngine::Precision::U8 &&
+                info.getMeanVariant() != InferenceEngine::MEAN_IMAGE) {
+            auto graphInput = graph->getNormalizedInputMemory(input.first);
+            if (graphInput) {
+                preProcData->second->execute(graphInput, info, false, m_curBatch, true);
+                filledInputs.insert(input.first);
+                continue;
+            }
+        }
+        preProcData->second->execute(input.second, info, false, m_curBatch);
+    }
+    return filledInputs;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -187,7 +233,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
         if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynamicShapes) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -214,7 +261,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynamicShapes) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -263,25 +311,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (graph->getProperty().dynamicShapes) {
+                // Any dimensions of the network rank are accepted, the network is compiled for them on inference
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Rank mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions mismatch.";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynamicShapes) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -297,27 +353,72 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+        if (graph->getProperty().dynamicShapes) {
+            // Dimensions of the output blob are checked on inference, see selectShapeGraph()
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Rank mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
         if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+                !graph->getProperty().batchLimit && !graph->getProperty().dynamicShapes) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectShapeGraph() {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    bool reshaped = false;
+    for (const auto& input : _networkInputs) {
+        auto blob = _inputs.find(input.first);
+        if (blob == _inputs.end())
+            continue;
+        const auto& dims = blob->second->getTensorDesc().getDims();
+        reshaped = reshaped || dims != input.second->getTensorDesc().getDims();
+        shapes[input.first] = dims;
+    }
+
+    // The graph is kept alive by the request as it may be evicted from the cache of the network
+    shapeGraph = reshaped ? execNetwork->GetGraph(shapes) : nullptr;
+    if (shapeGraph)
+        graph = shapeGraph.get();
+
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (const auto& output : graphOutputs) {
+        auto blob = _outputs.find(output.first);
+        if (blob == _outputs.end() || blob->second->getTensorDesc().getDims() == output.second->getTensorDesc().getDims())
+            continue;
+        const auto& desc = blob->second->getTensorDesc();
+        const auto& dims = output.second->getTensorDesc().getDims();
+        // Only blobs allocated by the plugin are replaced, the user blob must fit the graph selected for the inputs
+        if (userOutputs.find(output.first) != userOutputs.end()) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Output blob '" << output.first << "' has dimensions "
+                               << InferenceEngine::details::dumpVec(desc.getDims()) << " while the network produces "
+                               << InferenceEngine::details::dumpVec(dims) << " for the given inputs";
+        }
+        blob->second = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims,
+                                                                            InferenceEngine::TensorDesc::getLayoutByDims(dims)));
+        blob->second->allocate();
     }
 }
 
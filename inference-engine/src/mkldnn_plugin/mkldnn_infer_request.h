@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -51,9 +52,17 @@ private:
                      std::vector<InferenceEngine::Blob::Ptr> &convertedInputs);
 
     void changeDefaultPtr();
+    // Executes pre-processing of inputs, returns names of inputs written directly to the graph memory
+    std::set<std::string> execPreprocessing();
+    // Switches to the graph compiled for dimensions of the input blobs and fits the output blobs to it
+    void selectShapeGraph();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    MKLDNNGraph::Ptr                    shapeGraph;
     std::map<std::string, void*>        externalPtr;
+    // Outputs set by SetBlob(), they are never reallocated by the plugin
+    std::set<std::string>               userOutputs;
     openvino::itt::handle_t             profilingTask;
+    int                                 requestId = 0;
 };
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_planner.hpp"
+#include "mkldnn_edge.h"
+#include "mkldnn_extension_utils.h"
+
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+double sizeInBytes(const TensorDesc& desc) {
+    const auto& dims = desc.getDims();
+    return static_cast<double>(std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>())) *
+           desc.getPrecision().size();
+}
+
+// Reorder reads the source tensor and writes the destination one
+double reorderCost(const TensorDesc& from, const TensorDesc& to) {
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(from, to))
+        return 0.0;
+    return sizeInBytes(from) + sizeInBytes(to);
+}
+
+bool isPlanarSpatial(const TensorDesc& desc) {
+    if (desc.getDims().size() < 4 || desc.getLayout() == Layout::ANY)
+        return false;
+    const auto& order = desc.getBlockingDesc().getOrder();
+    if (order.size() != desc.getDims().size())
+        return false;
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] != i)
+            return false;
+    }
+    return true;
+}
+
+// JIT kernels vectorize over channels, so they process planar tensors less efficiently than blocked or channel-last ones
+double layoutEfficiencyFactor(impl_desc_type type, const TensorDesc& desc) {
+    return ((type & impl_desc_type::jit) && isPlanarSpatial(desc)) ? 1.5 : 1.0;
+}
+
+}  // namespace
+
+MKLDNNLayoutPlanner::MKLDNNLayoutPlanner(const std::vector<MKLDNNNodePtr>& nodes, size_t maxPasses)
+    : nodes(nodes), maxPasses(maxPasses) {}
+
+bool MKLDNNLayoutPlanner::isPlannable(const MKLDNNNodePtr& node) const {
+    switch (node->getType()) {
+        // have their own selection logic or fixed layouts
+        case Input:
+        case Output:
+        case Reorder:
+        case Split:
+        case Concatenation:
+        case Eltwise:
+        case MemoryInput:
+        case MemoryOutput:
+        case TensorIterator:
+            return false;
+        default:
+            break;
+    }
+    if (node->isConstant() || node->getSelectedPrimitiveDescriptor() == nullptr)
+        return false;
+
+    for (auto& pd : node->getSupportedPrimitiveDescriptors()) {
+        const auto config = pd.getConfig();
+        for (auto& inConf : config.inConfs) {
+            if (inConf.inPlace >= 0)
+                return false;
+        }
+        for (auto& outConf : config.outConfs) {
+            if (outConf.inPlace >= 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+double MKLDNNLayoutPlanner::nodeCost(const MKLDNNNodePtr& node, const PrimitiveDescInfo& pd) const {
+    const auto config = pd.getConfig();
+    const auto type = pd.getImplementationType();
+    double cost = 0.0;
+
+    for (size_t i = 0; i < config.inConfs.size() && i < node->getParentEdges().size(); i++) {
+        const auto& inDesc = config.inConfs[i].desc;
+        cost += sizeInBytes(inDesc) * layoutEfficiencyFactor(type, inDesc);
+
+        auto parentEdge = node->getParentEdgeAt(i);
+        auto parent = parentEdge->getParent();
+        auto* parentPD = parent->getSelectedPrimitiveDescriptor();
+        // Reorders of constant data are performed once at load time
+        if (parentPD == nullptr || parent->isConstant() || parentPD->getConfig().outConfs.empty())
+            continue;
+        int inNum = parentEdge->getInputNum();
+        if (inNum < 0 || inNum >= parentPD->getConfig().outConfs.size())
+            inNum = 0;
+        cost += reorderCost(parentPD->getConfig().outConfs[inNum].desc, inDesc);
+    }
+
+    for (auto& outConf : config.outConfs) {
+        cost += sizeInBytes(outConf.desc) * layoutEfficiencyFactor(type, outConf.desc);
+    }
+
+    for (size_t i = 0; i < node->getChildEdges().size() && !config.outConfs.empty(); i++) {
+        auto childEdge = node->getChildEdgeAt(i);
+        auto* childPD = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+        int outNum = childEdge->getOutputNum();
+        if (childPD == nullptr || outNum < 0 || outNum >= childPD->getConfig().inConfs.size())
+            continue;
+        int inNum = childEdge->getInputNum();
+        if (inNum < 0 || inNum >= config.outConfs.size())
+            inNum = 0;
+        cost += reorderCost(config.outConfs[inNum].desc, childPD->getConfig().inConfs[outNum].desc);
+    }
+
+    return cost;
+}
+
+size_t MKLDNNLayoutPlanner::plan() {
+    std::vector<MKLDNNNodePtr> plannable;
+    for (auto& node : nodes) {
+        if (isPlannable(node))
+            plannable.push_back(node);
+    }
+
+    size_t changed = 0;
+    for (size_t pass = 0; pass < maxPasses; pass++) {
+        bool improved = false;
+        for (auto& node : plannable) {
+            const auto& candidates = node->getSupportedPrimitiveDescriptors();
+            const int selected = static_cast<int>(node->getSelectedPrimitiveDescriptor() - candidates.data());
+            const auto selectedType = candidates[selected].getImplementationType();
+
+            int best = selected;
+            double bestCost = nodeCost(node, candidates[selected]);
+            for (size_t i = 0; i < candidates.size(); i++) {
+                if (static_cast<int>(i) == selected || candidates[i].getImplementationType() != selectedType ||
+                        candidates[i].getConfig().inConfs.size() > node->getParentEdges().size())
+                    continue;
+                double cost = nodeCost(node, candidates[i]);
+                // Strict improvement only, so that the planner converges and keeps the node's preference on ties
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    best = static_cast<int>(i);
+                }
+            }
+
+            if (best != selected) {
+                node->selectPrimitiveDescriptorByIndex(best);
+                improved = true;
+                changed++;
+            }
+        }
+        if (!improved)
+            break;
+    }
+    return changed;
+}
+
+}  // namespace MKLDNNPlugin
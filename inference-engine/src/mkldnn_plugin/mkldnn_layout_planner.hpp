@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides a declaration of LayoutPlanner utility class
+ * @file
+ */
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Refines primitive descriptors chosen by nodes one by one, taking into account the whole graph.
+ *
+ * Each node selects its descriptor looking at already selected producers only, so a layout which is
+ * good locally may force reorders of its consumers. The planner estimates the cost of a descriptors
+ * assignment as the sum of
+ * - reorders cost: bytes read and written by each reorder forced by mismatching edge layouts
+ * - kernels cost: bytes processed by each node scaled by the efficiency of the kernel for the chosen layouts
+ *
+ * and iteratively replaces the descriptor of each node with the cheapest one for the current choice
+ * of its neighbours, until no node can be improved.
+ *
+ *  NOTE!
+ *  Only descriptors of the same implementation type as the initially selected one are considered,
+ *  so the kernels priority list is respected. Nodes with their own selection logic or in-place
+ *  descriptors are kept as is. Costs are estimated only, candidate kernels are never executed.
+ */
+class MKLDNNLayoutPlanner {
+public:
+    /**
+     * @param nodes Graph nodes with selected primitive descriptors in topological order
+     */
+    explicit MKLDNNLayoutPlanner(const std::vector<MKLDNNNodePtr>& nodes, size_t maxPasses = 4);
+
+    /**
+     * @brief Performs the planning
+     * @return Number of nodes with changed primitive descriptors
+     */
+    size_t plan();
+
+private:
+    bool isPlannable(const MKLDNNNodePtr& node) const;
+    double nodeCost(const MKLDNNNodePtr& node, const PrimitiveDescInfo& pd) const;
+
+    const std::vector<MKLDNNNodePtr>& nodes;
+    size_t maxPasses;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,12 +7,31 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+namespace {
+
+/** Offset value of a box which is not placed yet */
+constexpr int64_t notPlaced = -1;
+
+/** Max number of box placements checked by branch and bound search */
+constexpr size_t exactSearchBudget = 100000;
+
+inline bool intersectInTime(const MemorySolver::Box &l, const MemorySolver::Box &r) {
+    return l.start <= r.finish && r.start <= l.finish;
+}
+
+}  // namespace
+
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, size_t exactSearchMaxBoxes) :
+    _boxes(boxes), _exact_search_max_boxes(exactSearchMaxBoxes) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -42,58 +61,59 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
         b.start -= rm_ts_s;
         b.finish -= rm_ts_f;
     }
-    _time_duration = ts_f - rm_ts_f;
-}
-
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
-    }
 }
 
 int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
+    if (_boxes.empty()) return 0;
+
+    const int64_t lower_bound = maxDepth();
+    calcNeighbours();
+
+    auto duration = [](const Box &box) { return static_cast<int64_t>(box.finish - box.start + 1); };
+    const std::vector<std::function<bool(const Box&, const Box&)>> orders = {
+        // biggest first
+        [&](const Box &l, const Box &r) {
+            return l.size > r.size || (l.size == r.size && duration(l) > duration(r));
+        },
+        // longest living first
+        [&](const Box &l, const Box &r) {
+            return duration(l) > duration(r) || (duration(l) == duration(r) && l.size > r.size);
+        },
+        // biggest area first
+        [&](const Box &l, const Box &r) {
+            return l.size * duration(l) > r.size * duration(r);
+        },
+    };
+
+    int64_t best_required = std::numeric_limits<int64_t>::max();
+    std::vector<int64_t> best_offsets, offsets;
+    std::vector<size_t> order(_boxes.size());
+    for (const auto &less : orders) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) { return less(_boxes[l], _boxes[r]); });
+
+        for (bool best_fit : {true, false}) {
+            int64_t required = placeGreedy(order, best_fit, offsets);
+            if (required < best_required) {
+                best_required = required;
+                best_offsets = offsets;
             }
-        } while (popped_up);
-
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+            if (best_required <= lower_bound) break;
+        }
+        if (best_required <= lower_bound) break;
+    }
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+    if (best_required > lower_bound && _boxes.size() <= _exact_search_max_boxes) {
+        offsets.assign(_boxes.size(), notPlaced);
+        size_t budget = exactSearchBudget;
+        placeExact(offsets, 0, _boxes.size(), 0, best_required, best_offsets, budget);
     }
 
-    return _min_required;
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = best_offsets[i];
+
+    return best_required;
 }
 
 int64_t MemorySolver::maxDepth() {
@@ -114,6 +134,83 @@ int64_t MemorySolver::getOffset(int id) const {
 
 //======== Private =============//
 
+void MemorySolver::calcNeighbours() {
+    _neighbours.assign(_boxes.size(), {});
+    // boxes are sorted by start in constructor
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        for (size_t j = i + 1; j < _boxes.size() && _boxes[j].start <= _boxes[i].finish; j++) {
+            _neighbours[i].push_back(j);
+            _neighbours[j].push_back(i);
+        }
+    }
+}
+
+int64_t MemorySolver::findOffset(size_t box, const std::vector<int64_t>& offsets, bool bestFit) const {
+    const int64_t size = _boxes[box].size;
+
+    // memory ranges occupied by already placed boxes which are alive together with the new one
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    busy.reserve(_neighbours[box].size());
+    for (size_t neighbour : _neighbours[box]) {
+        if (offsets[neighbour] != notPlaced)
+            busy.emplace_back(offsets[neighbour], offsets[neighbour] + _boxes[neighbour].size);
+    }
+    std::sort(busy.begin(), busy.end());
+
+    int64_t best_offset = notPlaced;
+    int64_t best_gap = std::numeric_limits<int64_t>::max();
+    int64_t top = 0;
+    for (const auto &range : busy) {
+        int64_t gap = range.first - top;
+        if (gap >= size) {
+            if (!bestFit) return top;
+            if (gap < best_gap) {
+                best_gap = gap;
+                best_offset = top;
+            }
+        }
+        top = std::max(top, range.second);
+    }
+    return best_offset == notPlaced ? top : best_offset;
+}
+
+int64_t MemorySolver::placeGreedy(const std::vector<size_t>& order, bool bestFit, std::vector<int64_t>& offsets) const {
+    offsets.assign(_boxes.size(), notPlaced);
+    int64_t required = 0;
+    for (size_t box : order) {
+        offsets[box] = findOffset(box, offsets, bestFit);
+        required = std::max(required, offsets[box] + _boxes[box].size);
+    }
+    return required;
+}
+
+void MemorySolver::placeExact(std::vector<int64_t>& offsets, size_t placed, size_t last, int64_t required,
+                              int64_t& best_required, std::vector<int64_t>& best_offsets, size_t& budget) {
+    if (placed == _boxes.size()) {
+        best_required = required;
+        best_offsets = offsets;
+        return;
+    }
+
+    // Placing boxes in order of offsets of an optimal solution to the lowest free position gives
+    // the optimal solution, so it is enough to check all orders with the lowest position placement
+    for (size_t box = 0; box < _boxes.size() && budget > 0 && best_required > _depth; box++) {
+        if (offsets[box] != notPlaced) continue;
+        // boxes without ExecOrder-axis intersection do not affect placement of each other,
+        // so only one order of such boxes is checked
+        if (last < _boxes.size() && box < last && !intersectInTime(_boxes[last], _boxes[box])) continue;
+
+        budget--;
+        int64_t offset = findOffset(box, offsets, false);
+        int64_t box_required = std::max(required, offset + _boxes[box].size);
+        if (box_required >= best_required) continue;
+
+        offsets[box] = offset;
+        placeExact(offsets, placed + 1, box, box_required, best_required, best_offsets, budget);
+        offsets[box] = notPlaced;
+    }
+}
+
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
     int64_t depth = 0;
@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <vector>
@@ -42,6 +43,11 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The solution is searched by several greedy passes (boxes are placed one by one into the best
+ *  fitting gap or to the lowest free position, in order of size, life time or area). The best one
+ *  is taken. If it is above the maxDepth() lower bound and the number of boxes is small enough,
+ *  branch and bound search over placement orders is performed additionally.
  */
 
 class MemorySolver {
@@ -65,7 +71,12 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /**
+     * @param boxes Boxes to place
+     * @param exactSearchMaxBoxes Max number of boxes for which branch and bound search is performed.
+     *        0 disables the search
+     */
+    explicit MemorySolver(const std::vector<Box>& boxes, size_t exactSearchMaxBoxes = 12);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -86,9 +97,17 @@ private:
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
-    int _time_duration = -1;
+    size_t _exact_search_max_boxes = 0;
+
+    /** Indexes of boxes which have an ExecOrder-axis intersection with each box */
+    std::vector<std::vector<size_t>> _neighbours;
 
     void calcDepth();
+    void calcNeighbours();
+    int64_t findOffset(size_t box, const std::vector<int64_t>& offsets, bool bestFit) const;
+    int64_t placeGreedy(const std::vector<size_t>& order, bool bestFit, std::vector<int64_t>& offsets) const;
+    void placeExact(std::vector<int64_t>& offsets, size_t placed, size_t last, int64_t required,
+                    int64_t& best_required, std::vector<int64_t>& best_offsets, size_t& budget);
 };
 
 }  // namespace MKLDNNPlugin
@@ -12,7 +12,9 @@
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <xml_parse_utils.h>
 #include <vector>
+#include <cstdint>
 #include <tuple>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
@@ -256,7 +258,150 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    MKLDNNExecNetwork::NetworkReshaper reshaper;
+    if (conf.dynamicShapes && network.getFunction()) {
+        // Other input shapes are applied to the original function, since the transformed one may have them folded
+        std::shared_ptr<ICNNNetwork> sourceNetwork = cloneNetwork(network);
+        reshaper = [sourceNetwork, conf](const ICNNNetwork::InputShapes &shapes) {
+            std::shared_ptr<ICNNNetwork> reshapedNetwork = cloneNetwork(*sourceNetwork);
+            ResponseDesc resp;
+            if (reshapedNetwork->reshape(shapes, &resp) != OK)
+                THROW_IE_EXCEPTION << resp.msg;
+            Transformation(reshapedNetwork, conf);
+            auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(reshapedNetwork);
+            if (implNetwork) {
+                ConstTransformer transformator(implNetwork.get());
+                transformator.fullTrim();
+            }
+            return reshapedNetwork;
+        };
+    }
+
+    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing, reshaper);
+}
+
+ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load_string(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    std::map<std::string, std::string> importedConfigs;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        importedConfigs.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& cfg : config) {
+        importedConfigs[cfg.first] = cfg.second;
+    }
+
+    auto readSize = [&] {
+        std::uint64_t dataSize = 0;
+        networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+        return static_cast<std::size_t>(dataSize);
+    };
+
+    std::string xmlString(readSize(), '\0');
+    networkModel.read(&xmlString[0], xmlString.size());
+
+    Blob::Ptr dataBlob;
+    auto dataSize = readSize();
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {dataSize}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin network model";
+    }
+
+    auto network = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = network.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Imported network has no input " << GetStrAttr(inputNode, "name");
+        }
+        auto& preProcess = input->second->getPreProcess();
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(inputNode, "resize-algorithm")));
+        preProcess.setColorFormat(static_cast<ColorFormat>(GetIntAttr(inputNode, "color-format")));
+        preProcess.setLetterbox(GetBoolAttr(inputNode, "letterbox", false), GetFloatAttr(inputNode, "pad-value", 0.f));
+    }
+
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        network.addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"));
+    }
+    auto outputs = network.getOutputsInfo();
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Imported network has no output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    Config conf = engConfig;
+    conf.readProperties(importedConfigs);
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+
+    MKLDNNGraphPlan::Ptr plan;
+    auto planNode = cpuNode.child("plan");
+    if (!planNode.empty()) {
+        plan = std::make_shared<MKLDNNGraphPlan>();
+        plan->workspaceSize = GetInt64Attr(planNode, "workspace-size");
+        plan->workspaceLowerBound = GetInt64Attr(planNode, "workspace-lower-bound");
+        auto descriptorsNode = planNode.child("descriptors");
+        for (auto descriptorNode = descriptorsNode.child("descriptor"); !descriptorNode.empty();
+                descriptorNode = descriptorNode.next_sibling("descriptor")) {
+            plan->selectedDescriptors[GetStrAttr(descriptorNode, "node")] = {
+                GetIntAttr(descriptorNode, "index"),
+                static_cast<size_t>(GetUInt64Attr(descriptorNode, "supported")),
+                static_cast<impl_desc_type>(GetIntAttr(descriptorNode, "impl-type"))};
+        }
+        auto boxesNode = planNode.child("boxes");
+        for (auto boxNode = boxesNode.child("box"); !boxNode.empty(); boxNode = boxNode.next_sibling("box")) {
+            plan->boxes.push_back({GetIntAttr(boxNode, "start"), GetIntAttr(boxNode, "finish"),
+                                   GetInt64Attr(boxNode, "size"), GetInt64Attr(boxNode, "id")});
+            plan->offsets.push_back(GetInt64Attr(boxNode, "offset"));
+        }
+        plan->recorded = true;
+    }
+
+    // The exported network has already passed through Transformation(), so it is not applied again
+    auto impl = std::make_shared<MKLDNNExecNetwork>(static_cast<ICNNNetwork&>(network), conf, extensionManager, weightsSharing,
+                                                    MKLDNNExecNetwork::NetworkReshaper{}, plan);
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(network.getInputsInfo(), network.getOutputsInfo(), networkInputs, networkOutputs);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPlugin(shared_from_this());
+
+    return make_executable_network(impl);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -299,6 +444,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -345,6 +491,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
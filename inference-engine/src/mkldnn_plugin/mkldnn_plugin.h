@@ -9,6 +9,7 @@
 
 #include <string>
 #include <map>
+#include <istream>
 #include <unordered_map>
 #include <memory>
 #include <functional>
@@ -25,6 +26,9 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
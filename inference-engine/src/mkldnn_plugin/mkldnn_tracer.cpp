@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tracer.hpp"
+#include "utils/json_utils.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Small sequential thread identifiers are easier to read in a trace viewer than native ones
+uint32_t currentThreadId() {
+    static std::atomic<uint32_t> threadsNum = {0};
+    thread_local uint32_t threadId = threadsNum++;
+    return threadId;
+}
+
+// Microseconds with nanosecond precision, without exponent notation for long runs
+std::string toMicroseconds(uint64_t ns) {
+    std::string fraction = std::to_string(ns % 1000);
+    return std::to_string(ns / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+}
+
+struct EventData {
+    uint64_t begin;
+    uint64_t end;
+    uint32_t nameId;
+    int32_t streamId;
+    int32_t requestId;
+    uint32_t threadId;
+};
+
+}  // namespace
+
+MKLDNNTracer::MKLDNNTracer(size_t capacity) : epoch(now()) {
+    size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    events.reset(new Event[size]);
+    mask = size - 1;
+}
+
+uint32_t MKLDNNTracer::registerName(const std::string& name, const std::string& category) {
+    std::lock_guard<std::mutex> lock(namesGuard);
+    auto key = std::make_pair(name, category);
+    auto found = nameIds.find(key);
+    if (found != nameIds.end())
+        return found->second;
+    names.push_back(key);
+    auto nameId = static_cast<uint32_t>(names.size() - 1);
+    nameIds.emplace(std::move(key), nameId);
+    return nameId;
+}
+
+void MKLDNNTracer::record(uint32_t nameId, int streamId, int requestId, TimePoint begin, TimePoint end) {
+    const uint64_t ticket = recorded.fetch_add(1, std::memory_order_relaxed);
+    Event& event = events[ticket & mask];
+
+    // Odd sequence marks the slot as being written
+    event.sequence.store(2 * ticket + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    event.begin.store(std::chrono::duration_cast<std::chrono::nanoseconds>(begin - epoch).count(), std::memory_order_relaxed);
+    event.end.store(std::chrono::duration_cast<std::chrono::nanoseconds>(end - epoch).count(), std::memory_order_relaxed);
+    event.nameId.store(nameId, std::memory_order_relaxed);
+    event.streamId.store(streamId, std::memory_order_relaxed);
+    event.requestId.store(requestId, std::memory_order_relaxed);
+    event.threadId.store(currentThreadId(), std::memory_order_relaxed);
+
+    event.sequence.store(2 * ticket + 2, std::memory_order_release);
+}
+
+void MKLDNNTracer::writeChromeTrace(std::ostream& out) const {
+    std::vector<EventData> snapshot;
+    snapshot.reserve(mask + 1);
+    for (size_t i = 0; i <= mask; i++) {
+        const Event& event = events[i];
+        const uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+        if (sequence == 0 || (sequence & 1))
+            continue;
+
+        EventData data;
+        data.begin = event.begin.load(std::memory_order_relaxed);
+        data.end = event.end.load(std::memory_order_relaxed);
+        data.nameId = event.nameId.load(std::memory_order_relaxed);
+        data.streamId = event.streamId.load(std::memory_order_relaxed);
+        data.requestId = event.requestId.load(std::memory_order_relaxed);
+        data.threadId = event.threadId.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.sequence.load(std::memory_order_relaxed) == sequence)
+            snapshot.push_back(data);
+    }
+    std::sort(snapshot.begin(), snapshot.end(), [](const EventData& a, const EventData& b) { return a.begin < b.begin; });
+
+    std::lock_guard<std::mutex> lock(namesGuard);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+
+    // Each stream is shown as a separate process
+    std::set<int32_t> streams;
+    for (auto& data : snapshot)
+        streams.insert(data.streamId);
+    for (auto stream : streams) {
+        out << (first ? "" : ",") << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << stream
+            << ",\"args\":{\"name\":\"Stream " << stream << "\"}}";
+        first = false;
+    }
+
+    for (auto& data : snapshot) {
+        if (data.nameId >= names.size())
+            continue;
+        out << (first ? "" : ",")
+            << "{\"name\":\"" << escapeJson(names[data.nameId].first)
+            << "\",\"cat\":\"" << escapeJson(names[data.nameId].second)
+            << "\",\"ph\":\"X\",\"ts\":" << toMicroseconds(data.begin)
+            << ",\"dur\":" << toMicroseconds(data.end - data.begin)
+            << ",\"pid\":" << data.streamId
+            << ",\"tid\":" << data.threadId
+            << ",\"args\":{\"request\":" << data.requestId << "}}";
+        first = false;
+    }
+    out << "],\"displayTimeUnit\":\"ns\"}";
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Recorder of inference timeline events
+ * Events are kept in a fixed size ring buffer, so only the latest ones are available.
+ * Recording is lock free and may be done concurrently from any number of threads.
+ */
+class MKLDNNTracer {
+public:
+    typedef std::shared_ptr<MKLDNNTracer> Ptr;
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    /**
+     * @param capacity Maximal number of stored events, rounded up to a power of two
+     */
+    explicit MKLDNNTracer(size_t capacity = 1 << 16);
+
+    /**
+     * Registers a name and a category of events. Graphs created for other input shapes register
+     * the same names again, so an already registered pair gets its previous identifier
+     * @return Identifier of the name to be passed to record()
+     */
+    uint32_t registerName(const std::string& name, const std::string& category);
+
+    /**
+     * Stores an event of the registered name executed in [begin, end) interval by the current thread
+     */
+    void record(uint32_t nameId, int streamId, int requestId, TimePoint begin, TimePoint end);
+
+    /**
+     * Writes the stored events in Chrome trace event format, which is accepted by chrome://tracing and Perfetto
+     */
+    void writeChromeTrace(std::ostream& out) const;
+
+    static TimePoint now() { return std::chrono::steady_clock::now(); }
+
+protected:
+    // Fields are atomic to let writers overwrite a slot while it is being read;
+    // a reader takes the slot only if its sequence was not changed during the read
+    struct Event {
+        std::atomic<uint64_t> sequence = {0};
+        std::atomic<uint64_t> begin = {0};
+        std::atomic<uint64_t> end = {0};
+        std::atomic<uint32_t> nameId = {0};
+        std::atomic<int32_t> streamId = {0};
+        std::atomic<int32_t> requestId = {0};
+        std::atomic<uint32_t> threadId = {0};
+    };
+
+    std::unique_ptr<Event[]> events;
+    size_t mask;
+    std::atomic<uint64_t> recorded = {0};
+    const TimePoint epoch;
+
+    std::vector<std::pair<std::string, std::string>> names;
+    std::map<std::pair<std::string, std::string>, uint32_t> nameIds;
+    mutable std::mutex namesGuard;
+};
+
+/**
+ * Records an event from the construction till the destruction if the tracer is set
+ */
+class MKLDNNTraceScope {
+public:
+    MKLDNNTraceScope(MKLDNNTracer* tracer, uint32_t nameId, int streamId, int requestId)
+        : tracer(tracer), nameId(nameId), streamId(streamId), requestId(requestId) {
+        if (tracer)
+            begin = MKLDNNTracer::now();
+    }
+
+    ~MKLDNNTraceScope() {
+        if (tracer)
+            tracer->record(nameId, streamId, requestId, begin, MKLDNNTracer::now());
+    }
+
+private:
+    MKLDNNTracer* tracer;
+    uint32_t nameId;
+    int streamId;
+    int requestId;
+    MKLDNNTracer::TimePoint begin;
+};
+
+}  // namespace MKLDNNPlugin
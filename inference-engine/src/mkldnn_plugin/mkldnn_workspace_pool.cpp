@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_pool.hpp"
+
+#include <memory>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+MKLDNNMemoryPtr MKLDNNWorkspacePool::acquire(size_t size, const mkldnn::engine& eng) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        // The smallest fitting block is taken, so small requests do not hold blocks needed by large ones
+        auto found = freeWorkspaces.end();
+        for (auto it = freeWorkspaces.begin(); it != freeWorkspaces.end(); ++it) {
+            if ((*it)->GetSize() >= size && (found == freeWorkspaces.end() || (*it)->GetSize() < (*found)->GetSize()))
+                found = it;
+        }
+        if (found != freeWorkspaces.end()) {
+            auto workspace = *found;
+            freeWorkspaces.erase(found);
+            return workspace;
+        }
+        allocated++;
+    }
+
+    auto workspace = std::make_shared<MKLDNNMemory>(eng);
+    workspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+    return workspace;
+}
+
+void MKLDNNWorkspacePool::release(const MKLDNNMemoryPtr& workspace) {
+    std::lock_guard<std::mutex> lock(guard);
+    freeWorkspaces.push_back(workspace);
+}
+
+size_t MKLDNNWorkspacePool::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return allocated;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_memory.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Pool of memory blocks for intermediate tensors of graphs
+ * Graphs take a block for the time of inference only, so the number of allocated blocks
+ * is limited by the number of concurrently running inferences
+ *
+ * Is a thread safe
+ */
+class MKLDNNWorkspacePool {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspacePool> Ptr;
+
+    /**
+     * Returns the smallest free block of at least the specified size or allocates a new one
+     */
+    MKLDNNMemoryPtr acquire(size_t size, const mkldnn::engine& eng);
+
+    /**
+     * Returns the block taken by acquire() back to the pool
+     */
+    void release(const MKLDNNMemoryPtr& workspace);
+
+    /**
+     * Number of blocks allocated by the pool
+     */
+    size_t size() const;
+
+protected:
+    std::vector<MKLDNNMemoryPtr> freeWorkspaces;
+    size_t allocated = 0;
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "non_max_suppression_imp.hpp"
 
 #include <cmath>
 #include <string>
@@ -93,41 +94,6 @@ public:
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (center_point_box) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
-    }
-
     typedef struct {
         float score;
         int batch_index;
@@ -169,47 +135,95 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
-
-        for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
+        max_output_boxes_per_class = (std::max)(max_output_boxes_per_class, 0);
+
+        // Corners and areas are computed once per box instead of once per pair of boxes
+        const size_t planeSize = static_cast<size_t>(num_batches) * num_boxes;
+        corners.resize(5 * planeSize);
+        parallel_for(num_batches, [&](int batch) {
+            const float *boxesPtr = boxes + batch * boxesStrides[0];
+            nms_boxes planes = getPlanes(corners.data(), planeSize, static_cast<size_t>(batch) * num_boxes);
+            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+                const float *box = boxesPtr + box_idx * 4;
+                if (center_point_box) {
+                    //  box format: x_center, y_center, width, height
+                    planes.ymin[box_idx] = box[1] - box[3] / 2.f;
+                    planes.xmin[box_idx] = box[0] - box[2] / 2.f;
+                    planes.ymax[box_idx] = box[1] + box[3] / 2.f;
+                    planes.xmax[box_idx] = box[0] + box[2] / 2.f;
+                } else {
+                    //  box format: y1, x1, y2, x2
+                    planes.ymin[box_idx] = (std::min)(box[0], box[2]);
+                    planes.xmin[box_idx] = (std::min)(box[1], box[3]);
+                    planes.ymax[box_idx] = (std::max)(box[0], box[2]);
+                    planes.xmax[box_idx] = (std::max)(box[1], box[3]);
+                }
+                planes.area[box_idx] = (planes.ymax[box_idx] - planes.ymin[box_idx]) * (planes.xmax[box_idx] - planes.xmin[box_idx]);
+            }
+        });
+
+        // Each (batch, class) pair is processed independently, each thread uses its own scratch buffers
+        const int work_amount = num_batches * num_classes;
+        const int nthr = parallel_get_max_threads();
+        if (threadScratch.size() < static_cast<size_t>(nthr))
+            threadScratch.resize(nthr);
+        selectedNum.resize(work_amount);
+        selectedBoxes.resize(static_cast<size_t>(work_amount) * max_output_boxes_per_class);
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            Scratch &scratch = threadScratch[ithr];
+            scratch.scores.resize(num_boxes);
+            scratch.candidates.resize(num_boxes);
+            scratch.kept.resize(5 * static_cast<size_t>(max_output_boxes_per_class));
+            nms_boxes kept = getPlanes(scratch.kept.data(), max_output_boxes_per_class, 0);
+
+            for_1d(ithr, nthr, work_amount, [&](int item) {
+                const int batch = item / num_classes;
+                const int class_idx = item % num_classes;
+                const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+
+                int num_candidates = 0;
                 for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                     if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                        scratch.scores[num_candidates++] = std::make_pair(scoresPtr[box_idx], box_idx);
                 }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
-                }
-            }
+                // Boxes with equal scores are taken in order of their indexes
+                std::sort(scratch.scores.begin(), scratch.scores.begin() + num_candidates,
+                    [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                        return l.first > r.first || (l.first == r.first && l.second < r.second);
+                    });
+                for (int i = 0; i < num_candidates; i++)
+                    scratch.candidates[i] = scratch.scores[i].second;
+
+                nms_boxes planes = getPlanes(corners.data(), planeSize, static_cast<size_t>(batch) * num_boxes);
+                // data() instead of operator[] as the buffer is empty when max_output_boxes_per_class is 0
+                int *selected = selectedBoxes.data() + static_cast<size_t>(item) * max_output_boxes_per_class;
+                selectedNum[item] = XARCH::nms_select(planes, scratch.candidates.data(), num_candidates, iou_threshold,
+                    max_output_boxes_per_class, kept, selected);
+            });
+        });
+
+        fb.clear();
+        for (int item = 0; item < work_amount; item++) {
+            const int batch = item / num_classes;
+            const int class_idx = item % num_classes;
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            const int *selected = selectedBoxes.data() + static_cast<size_t>(item) * max_output_boxes_per_class;
+            for (int i = 0; i < selectedNum[item]; i++)
+                fb.push_back({ scoresPtr[selected[i]], batch, class_idx, selected[i] });
         }
 
         if (sort_result_descending) {
-            parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
+            // Boxes with equal scores are ordered by batch, class and box indexes
+            parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) {
+                if (l.score != r.score)
+                    return l.score > r.score;
+                if (l.batch_index != r.batch_index)
+                    return l.batch_index < r.batch_index;
+                if (l.class_index != r.class_index)
+                    return l.class_index < r.class_index;
+                return l.box_index < r.box_index;
+            });
         }
 
         int selected_indicesStride = outputs[0]->getTensorDesc().getBlockingDesc().getStrides()[0];
@@ -239,6 +253,24 @@ private:
     const size_t NMS_SCORETHRESHOLD = 4;
     bool center_point_box = false;
     bool sort_result_descending = true;
+
+    struct Scratch {
+        std::vector<std::pair<float, int>> scores;
+        std::vector<int> candidates;
+        std::vector<float> kept;
+    };
+
+    static nms_boxes getPlanes(float* data, size_t planeSize, size_t offset) {
+        return { data + offset, data + planeSize + offset, data + 2 * planeSize + offset,
+                 data + 3 * planeSize + offset, data + 4 * planeSize + offset };
+    }
+
+    // Buffers are reused by subsequent calls, so they are reallocated only if the input shapes grow
+    std::vector<float> corners;
+    std::vector<Scratch> threadScratch;
+    std::vector<int> selectedNum;
+    std::vector<int> selectedBoxes;
+    std::vector<filteredBoxes> fb;
 };
 
 REG_FACTORY_FOR(NonMaxSuppressionImpl, NonMaxSuppression);
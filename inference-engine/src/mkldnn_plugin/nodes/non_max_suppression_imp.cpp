@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+    constexpr int block_size = 16;
+#elif defined(HAVE_AVX2)
+    constexpr int block_size = 8;
+#elif defined(HAVE_SSE42)
+    constexpr int block_size = 4;
+#endif
+
+int nms_select(const nms_boxes& boxes, const int* candidates, int num_candidates, float iou_threshold,
+        int max_output_boxes, nms_boxes& kept, int* selected) {
+    int kept_num = 0;
+    for (int c = 0; c < num_candidates && kept_num < max_output_boxes; c++) {
+        const int box = candidates[c];
+        const float ymin = boxes.ymin[box];
+        const float xmin = boxes.xmin[box];
+        const float ymax = boxes.ymax[box];
+        const float xmax = boxes.xmax[box];
+        const float area = boxes.area[box];
+
+        // IoU with a box of non positive area is zero, so such a box suppresses nothing and is never suppressed
+        bool suppressed = false;
+        if (area > 0.f) {
+            int k = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            const auto vymin = _mm_uni_set1_ps(ymin);
+            const auto vxmin = _mm_uni_set1_ps(xmin);
+            const auto vymax = _mm_uni_set1_ps(ymax);
+            const auto vxmax = _mm_uni_set1_ps(xmax);
+            const auto varea = _mm_uni_set1_ps(area);
+            const auto vthreshold = _mm_uni_set1_ps(iou_threshold);
+            const auto vzero = _mm_uni_setzero_ps();
+            for (; k <= kept_num - block_size && !suppressed; k += block_size) {
+                const auto karea = _mm_uni_loadu_ps(kept.area + k);
+                const auto height = _mm_uni_max_ps(_mm_uni_sub_ps(_mm_uni_min_ps(vymax, _mm_uni_loadu_ps(kept.ymax + k)),
+                                                                  _mm_uni_max_ps(vymin, _mm_uni_loadu_ps(kept.ymin + k))), vzero);
+                const auto width = _mm_uni_max_ps(_mm_uni_sub_ps(_mm_uni_min_ps(vxmax, _mm_uni_loadu_ps(kept.xmax + k)),
+                                                                 _mm_uni_max_ps(vxmin, _mm_uni_loadu_ps(kept.xmin + k))), vzero);
+                const auto intersection = _mm_uni_mul_ps(height, width);
+                const auto iou = _mm_uni_div_ps(intersection, _mm_uni_sub_ps(_mm_uni_add_ps(varea, karea), intersection));
+#if defined(HAVE_AVX512F)
+                suppressed = (_mm_uni_cmpgt_ps(iou, vthreshold) & _mm_uni_cmpgt_ps(karea, vzero)) != 0;
+#else
+                suppressed = _mm_uni_movemask_ps(_mm_uni_and_ps(_mm_uni_cmpgt_ps(iou, vthreshold),
+                                                                _mm_uni_cmpgt_ps(karea, vzero))) != 0;
+#endif
+            }
+#endif
+            for (; k < kept_num && !suppressed; k++) {
+                if (kept.area[k] <= 0.f)
+                    continue;
+                const float intersection =
+                    (std::max)((std::min)(ymax, kept.ymax[k]) - (std::max)(ymin, kept.ymin[k]), 0.f) *
+                    (std::max)((std::min)(xmax, kept.xmax[k]) - (std::max)(xmin, kept.xmin[k]), 0.f);
+                suppressed = intersection / (area + kept.area[k] - intersection) > iou_threshold;
+            }
+        }
+
+        if (!suppressed) {
+            kept.ymin[kept_num] = ymin;
+            kept.xmin[kept_num] = xmin;
+            kept.ymax[kept_num] = ymax;
+            kept.xmax[kept_num] = xmax;
+            kept.area[kept_num] = area;
+            selected[kept_num++] = box;
+        }
+    }
+    return kept_num;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes in planar layout, so that several boxes may be processed by a single vector instruction
+struct nms_boxes {
+    float* ymin;
+    float* xmin;
+    float* ymax;
+    float* xmax;
+    float* area;
+};
+
+namespace XARCH {
+
+// Greedily selects candidates (box indexes sorted by descending score) which do not overlap already selected ones
+// with IoU above the threshold. 'kept' is a scratch of at least max_output_boxes size. Returns number of selected boxes.
+int nms_select(const nms_boxes& boxes, const int* candidates, int num_candidates, float iou_threshold,
+        int max_output_boxes, nms_boxes& kept, int* selected);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -12,15 +15,75 @@ class PerfCount {
     uint64_t duration;
     uint32_t num;
 
+    // Latency histogram in nanoseconds: exact values below 16ns, then 8 sub-buckets per power of two,
+    // so any percentile is known with relative error below 12.5%. Empty if not enabled.
+    std::vector<uint32_t> histogram;
+    uint64_t maxDuration;
+
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    static constexpr int subBucketBits = 3;
+    static constexpr int maxExponent = 40;
+
 public:
-    PerfCount(): duration(0), num(0) {}
+    PerfCount(): duration(0), num(0), maxDuration(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    uint32_t count() const { return num; }
+
+    void enableHistogram() {
+        histogram.assign(bucketIndex(UINT64_MAX) + 1, 0);
+    }
+
+    bool hasHistogram() const { return !histogram.empty(); }
+
+    // Maximal latency in microseconds
+    double max() const { return maxDuration / 1000.0; }
+
+    // Latency in microseconds which is not exceeded by the given fraction of iterations
+    double percentile(double fraction) const {
+        uint64_t total = 0;
+        for (auto bucket : histogram)
+            total += bucket;
+        if (total == 0)
+            return 0.0;
+
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * total + 0.5));
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < histogram.size(); i++) {
+            accumulated += histogram[i];
+            if (accumulated >= rank)
+                return std::min(bucketUpperBound(i), maxDuration) / 1000.0;
+        }
+        return max();
+    }
+
 private:
+    static size_t bucketIndex(uint64_t ns) {
+        if (ns < (2u << subBucketBits))
+            return static_cast<size_t>(ns);
+
+        int exponent = 0;
+        for (uint64_t v = ns; v >>= 1;)
+            exponent++;
+        if (exponent > maxExponent)
+            return bucketIndex((2ull << maxExponent) - 1);
+
+        const uint64_t mantissa = ns >> (exponent - subBucketBits);
+        return (static_cast<size_t>(exponent - subBucketBits) << subBucketBits) + static_cast<size_t>(mantissa);
+    }
+
+    static uint64_t bucketUpperBound(size_t idx) {
+        if (idx < (2u << subBucketBits))
+            return idx;
+
+        const int exponent = static_cast<int>(idx >> subBucketBits) + subBucketBits - 1;
+        const uint64_t mantissa = (idx & ((1u << subBucketBits) - 1)) + (1u << subBucketBits);
+        return ((mantissa + 1) << (exponent - subBucketBits)) - 1;
+    }
+
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
     }
@@ -30,6 +93,12 @@ private:
 
         duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+
+        if (!histogram.empty()) {
+            const uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+            histogram[bucketIndex(ns)]++;
+            maxDuration = std::max(maxDuration, ns);
+        }
     }
 
     friend class PerfHelper;
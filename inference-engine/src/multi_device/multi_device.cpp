@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -79,6 +81,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
@@ -170,6 +173,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
+        _deviceStatistics[device]._numRequests = numRequests;
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
@@ -179,11 +183,28 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    auto endTime = std::chrono::steady_clock::now();
+                    // the service time is updated first, as the task may schedule the next inference,
+                    // while the request is counted as busy until it is back in the idle queue
+                    if (!_terminate) {
+                        std::lock_guard<std::mutex> lock(_statisticsMutex);
+                        auto& statistics = _deviceStatistics[device];
+                        const double serviceTime =
+                            std::chrono::duration<double, std::milli>(endTime - workerRequestPtr->_startTime).count();
+                        // exponential moving average follows the changes of the device load
+                        statistics._serviceTime = (0 == statistics._numCompleted) ? serviceTime :
+                                                  statistics._serviceTime + 0.2 * (serviceTime - statistics._serviceTime);
+                        statistics._numCompleted++;
+                    }
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
                     }
                     if (!_terminate) {
+                        {
+                            std::lock_guard<std::mutex> lock(_statisticsMutex);
+                            _deviceStatistics[device]._numBusyRequests--;
+                        }
                         idleGuard.Release()->push(workerRequestPtr);
                         ScheduleToWorkerInferRequest();
                     }
@@ -197,24 +218,63 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
-    for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
+    // The task goes to the device with idle worker requests that is expected to complete it first.
+    // A device with all worker requests busy completes the pending tasks in about
+    // serviceTime * (1 + numPendingTasks / numRequests), if it is faster than the idle ones the task stays in the queue
+    // and is scheduled when one of the worker requests of the device completes.
+    std::vector<std::pair<double, const DeviceInformation*>> idleDevices;
+    auto busyDeviceCompletionTime = std::numeric_limits<double>::max();
+    {
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        const auto numPendingTasks = std::max<std::size_t>(_numPendingTasks, 1);
+        for (auto&& device : devices) {
+            auto itStatistics = _deviceStatistics.find(device.deviceName);
+            if (_deviceStatistics.end() == itStatistics || 0 == itStatistics->second._numRequests) {
+                continue;
+            }
+            auto& statistics = itStatistics->second;
+            if (statistics._numBusyRequests < statistics._numRequests) {
+                idleDevices.emplace_back(statistics._serviceTime, &device);
+            } else if (0 != statistics._numCompleted) {
+                // a device which is not measured yet gives no bound
+                busyDeviceCompletionTime = std::min(busyDeviceCompletionTime,
+                    statistics._serviceTime * (1.0 + static_cast<double>(numPendingTasks) / statistics._numRequests));
+            }
+        }
+    }
+    // devices which are not measured yet go first, equally fast devices are taken in the priority order
+    std::stable_sort(idleDevices.begin(), idleDevices.end(),
+                     [] (const std::pair<double, const DeviceInformation*>& lhs, const std::pair<double, const DeviceInformation*>& rhs) {
+                         return lhs.first < rhs.first;
+                     });
+    for (auto&& idleDevice : idleDevices) {
+        if (idleDevice.first > busyDeviceCompletionTime) {
+            break;
+        }
+        auto& deviceName = idleDevice.second->deviceName;
+        auto& idleWorkerRequests = _idleWorkerRequests[deviceName];
         WorkerInferRequest* workerRequestPtr = nullptr;
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             Task inferPipelineTask;
             if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
+                _numPendingTasks--;
+                {
+                    std::lock_guard<std::mutex> lock(_statisticsMutex);
+                    _deviceStatistics[deviceName]._numBusyRequests++;
+                }
                 _thisWorkerInferRequest = workerRequestPtr;
                 inferPipelineTask();
                 idleGuard.Release();
-                break;
             }
+            break;
         }
     }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     if (!_terminate) {
+        _numPendingTasks++;
         _inferPipelineTasks.push(std::move(inferPipelineTask));
         ScheduleToWorkerInferRequest();
     }
@@ -313,12 +373,25 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second.GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(MULTI_DEVICE_SHARES)) {
+        std::map<std::string, float> shares;
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        std::size_t numCompleted = 0;
+        for (auto&& statistics : _deviceStatistics) {
+            numCompleted += statistics.second._numCompleted;
+        }
+        for (auto&& statistics : _deviceStatistics) {
+            shares[statistics.first] = (0 == numCompleted) ? 0.f :
+                static_cast<float>(statistics.second._numCompleted) / numCompleted;
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_SHARES, shares);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_SHARES)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -93,11 +94,19 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
     struct WorkerInferRequest {
-        InferenceEngine::InferRequest   _inferRequest;
-        Task                            _task;
-        InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        InferenceEngine::InferRequest           _inferRequest;
+        Task                                    _task;
+        InferenceEngine::StatusCode             _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point   _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
+    // Load and speed of a device the scheduler estimates the completion time of a task with
+    struct DeviceStatistics {
+        double          _serviceTime = 0.0;     // moving average of the worker request execution time, ms
+        unsigned int    _numRequests = 0;
+        unsigned int    _numBusyRequests = 0;
+        std::size_t     _numCompleted = 0;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -121,6 +130,9 @@ public:
     std::vector<DeviceInformation>                              _devicePriorities;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<Task>                                       _inferPipelineTasks;
+    std::atomic<std::size_t>                                    _numPendingTasks = {0};
+    mutable std::mutex                                          _statisticsMutex;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
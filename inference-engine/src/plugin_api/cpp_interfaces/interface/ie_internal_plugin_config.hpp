@@ -51,6 +51,13 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(AGGREGATED_PLUGIN);
 
+/**
+ * @brief This key tells a plugin that the executable network is going to be exported,
+ *        so the plugin keeps the data needed by Export. It is passed by Core when CACHE_DIR is set
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(EXPORTABLE_NETWORK);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -20,7 +20,10 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-stream queues. Tasks are distributed among the queues
+ *        round-robin and idle threads steal tasks from other streams, so with several streams
+ *        tasks passed to run() are not started in submission order: callers must not rely on any ordering
+ *        between tasks. With one stream tasks submitted from one thread are started in submission order.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -126,6 +126,34 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_8U_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_32F_impl(in, out, mean, scale, length);
+}
+
+void calcRowNearest_8U(const uint8_t in[], uint8_t out[], const int mapsx[], int length) {
+    calcRowNearest_impl(in, out, mapsx, length);
+}
+
+void calcRowNearest_32F(const float in[], float out[], const int mapsx[], int length) {
+    calcRowNearest_impl(in, out, mapsx, length);
+}
+
+void calcRowCubicH_32F(const float in[], float out[], const int mapsx[], const float alpha[], int length) {
+    calcRowCubicH_32F_impl(in, out, mapsx, alpha, length);
+}
+
+void calcRowCubicV_8U(const float* in[], uint8_t out[], const float beta[], int length) {
+    calcRowCubicV_8U_impl(in, out, beta, length);
+}
+
+void calcRowCubicV_32F(const float* in[], float out[], const float beta[], int length) {
+    calcRowCubicV_32F_impl(in, out, beta, length);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
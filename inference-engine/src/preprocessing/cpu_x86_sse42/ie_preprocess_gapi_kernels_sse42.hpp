@@ -199,6 +199,44 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void normalizeRow_8U(const uint8_t in[],
+                           float out[],
+                           float mean,
+                           float scale,
+                             int length);
+
+void normalizeRow_32F(const float in[],
+                            float out[],
+                            float mean,
+                            float scale,
+                              int length);
+
+void calcRowNearest_8U(const uint8_t in[],
+                             uint8_t out[],
+                       const int     mapsx[],
+                             int     length);
+
+void calcRowNearest_32F(const float in[],
+                              float out[],
+                        const int   mapsx[],
+                              int   length);
+
+void calcRowCubicH_32F(const float in[],
+                             float out[],
+                       const int   mapsx[],
+                       const float alpha[],
+                             int   length);
+
+void calcRowCubicV_8U(const float*  in[],
+                           uint8_t out[],
+                      const float   beta[],
+                            int     length);
+
+void calcRowCubicV_32F(const float* in[],
+                             float  out[],
+                       const float  beta[],
+                             int    length);
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -3,6 +3,7 @@
 //
 
 #include "ie_preprocess_gapi.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
 #include "ie_system_conf.h"
 #include "blob_transform.hpp"
 #include "ie_preprocess_data.hpp"
@@ -18,6 +19,8 @@
 
 #include <memory>
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -761,6 +764,7 @@ class PreProcessData : public IPreProcessData {
     Blob::Ptr _roiBlob = nullptr;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
+    Blob::Ptr _tmp3 = nullptr;
 
     /**
      * @brief Pointer-to-implementation (PIMPL) hiding preprocessing implementation details.
@@ -768,16 +772,25 @@ class PreProcessData : public IPreProcessData {
      */
     std::shared_ptr<PreprocEngine> _preproc;
 
+    void executeLetterbox(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize,
+                          const PreprocEngine::Normalization& normalization);
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
+
+    void executeRois(const Blob::Ptr &src, const std::vector<ROI> &rois, Blob::Ptr &outBlob,
+                     const PreProcessInfo& info, bool serial, bool normalize = false) override;
 
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+    void getCacheStats(size_t &hits, size_t &misses) const override;
 };
 
 StatusCode CreatePreProcessData(IPreProcessData *& data, ResponseDesc * /*resp*/) noexcept {
@@ -797,28 +810,177 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
     return _roiBlob;
 }
 
+void PreProcessData::getCacheStats(size_t &hits, size_t &misses) const {
+    hits = _preproc ? _preproc->cacheHits() : 0;
+    misses = _preproc ? _preproc->cacheMisses() : 0;
+}
+
+namespace {
+
+PreprocEngine::Normalization getNormalization(const PreProcessInfo& info, const Blob::Ptr& outBlob) {
+    PreprocEngine::Normalization normalization;
+    const size_t channels = info.getNumberOfChannels();
+    if (channels == 0) {
+        return normalization;
+    }
+    if (info.getMeanVariant() == MEAN_IMAGE) {
+        THROW_IE_EXCEPTION << "Input pre-processing supports mean values only, mean image is unsupported";
+    }
+    if (channels != outBlob->getTensorDesc().getDims()[1]) {
+        THROW_IE_EXCEPTION << "Number of mean values " << channels << " is not equal to number of channels "
+                           << outBlob->getTensorDesc().getDims()[1];
+    }
+
+    for (size_t c = 0; c < channels; c++) {
+        normalization.first.push_back(info.getMeanVariant() == MEAN_VALUE ? info[c]->meanValue : 0.f);
+        normalization.second.push_back(info[c]->stdScale);
+    }
+    return normalization;
+}
+
+void normalizeBlob(const Blob::Ptr& src, Blob::Ptr& dst, const PreprocEngine::Normalization& normalization) {
+    const auto& dims = dst->getTensorDesc().getDims();
+    const size_t N = dims[0], C = dims[1], spatial = dims[2] * dims[3];
+    const bool nhwc = dst->getTensorDesc().getLayout() == NHWC;
+
+    const auto in = src->cbuffer().as<const uint8_t*>() + src->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto out = dst->buffer().as<float*>() + dst->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            const float mean = normalization.first.empty() ? 0.f : normalization.first[c];
+            const float scale = normalization.second.empty() ? 1.f : normalization.second[c];
+            for (size_t i = 0; i < spatial; i++) {
+                const size_t dstIdx = nhwc ? (n * spatial + i) * C + c : (n * C + c) * spatial + i;
+                out[dstIdx] = (static_cast<float>(in[(n * C + c) * spatial + i]) - mean) * scale;
+            }
+        }
+    }
+}
+
+template <typename T>
+void fillPad(const Blob::Ptr& dst, size_t n, const std::vector<float>& values,
+             size_t x0, size_t y0, size_t w, size_t h) {
+    const auto& dims = dst->getTensorDesc().getDims();
+    const size_t C = dims[1], H = dims[2], W = dims[3];
+    const bool nhwc = dst->getTensorDesc().getLayout() == NHWC;
+
+    auto out = dst->buffer().as<T*>() + dst->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    for (size_t c = 0; c < C; c++) {
+        const T value = gapi::kernels::saturate_cast<T>(values[c]);
+        const auto fill = [&](size_t y, size_t from, size_t to) {
+            for (size_t x = from; x < to; x++) {
+                const size_t dstIdx = nhwc ? ((n * H + y) * W + x) * C + c : ((n * C + c) * H + y) * W + x;
+                out[dstIdx] = value;
+            }
+        };
+
+        for (size_t y = 0; y < H; y++) {
+            if (y >= y0 && y < y0 + h) {
+                fill(y, 0, x0);
+                fill(y, x0 + w, W);
+            } else {
+                fill(y, 0, W);
+            }
+        }
+    }
+}
+
+SizeVector inputDims(const Blob::Ptr& blob) {
+    if (blob->is<NV12Blob>()) {
+        return blob->as<NV12Blob>()->y()->getTensorDesc().getDims();
+    }
+    if (blob->is<I420Blob>()) {
+        return blob->as<I420Blob>()->y()->getTensorDesc().getDims();
+    }
+    return blob->getTensorDesc().getDims();
+}
+
+}  // namespace
+
+// The input is resized into the centered ROI of the output which keeps the aspect ratio,
+// the rest of the output is filled with the (normalized) pad value
+void PreProcessData::executeLetterbox(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize,
+                                      const PreprocEngine::Normalization& normalization) {
+    if (info.getResizeAlgorithm() == NO_RESIZE) {
+        THROW_IE_EXCEPTION << "Letterbox pre-processing requires resize algorithm to be set";
+    }
+    if (batchSize > 1 && !_roiBlob->is<MemoryBlob>()) {
+        THROW_IE_EXCEPTION << "Letterbox pre-processing of batched compound blobs is unsupported";
+    }
+
+    const auto in_dims = inputDims(_roiBlob);
+    const auto& out_dims = outBlob->getTensorDesc().getDims();
+    const size_t inW = in_dims[3], inH = in_dims[2];
+    const size_t outW = out_dims[3], outH = out_dims[2];
+
+    const float ratio = std::min(static_cast<float>(outW) / inW, static_cast<float>(outH) / inH);
+    const size_t w = std::min(outW, std::max<size_t>(1, static_cast<size_t>(std::round(inW * ratio))));
+    const size_t h = std::min(outH, std::max<size_t>(1, static_cast<size_t>(std::round(inH * ratio))));
+    const size_t x0 = (outW - w) / 2;
+    const size_t y0 = (outH - h) / 2;
+
+    std::vector<float> pad(out_dims[1], info.getPadValue());
+    for (size_t c = 0; c < normalization.first.size(); c++) {
+        pad[c] = (pad[c] - normalization.first[c]) * normalization.second[c];
+    }
+
+    for (int b = 0; b < batchSize; b++) {
+        switch (outBlob->getTensorDesc().getPrecision()) {
+        case Precision::U8:   fillPad<uint8_t>(outBlob, b, pad, x0, y0, w, h); break;
+        case Precision::U16:  fillPad<uint16_t>(outBlob, b, pad, x0, y0, w, h); break;
+        case Precision::FP32: fillPad<float>(outBlob, b, pad, x0, y0, w, h); break;
+        default: THROW_IE_EXCEPTION << "Letterbox pre-processing is unsupported for the output precision "
+                                    << outBlob->getTensorDesc().getPrecision();
+        }
+
+        const auto in = batchSize > 1 ? _roiBlob->createROI(ROI(b, 0, 0, inW, inH)) : _roiBlob;
+        auto out = outBlob->createROI(ROI(b, x0, y0, w, h));
+        if (!_preproc->preprocessWithGAPI(in, out, info.getResizeAlgorithm(), info.getColorFormat(), serial, 1,
+                                          normalization)) {
+            THROW_IE_EXCEPTION << "Letterbox pre-processing is unsupported in this mode. "
+                                  "Use default pre-processing instead.";
+        }
+    }
+}
+
 void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
     auto fmt = info.getColorFormat();
 
-    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW) {
-       THROW_IE_EXCEPTION << "Input pre-processing is called without the pre-processing info set: "
-                             "there's nothing to be done";
-    }
-
     if (_roiBlob == nullptr) {
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    // Regions of one image are pre-processed into the batch slots of the output blob in a single pass
+    if (auto rois = _roiBlob->as<ROIsBlob>()) {
+        executeRois(rois->image(), rois->rois(), outBlob, info, serial, normalize);
+        return;
+    }
+
+    // On request U8 input is converted to FP32 output, mean values and scales are applied in the same pass then
+    const bool normalize_needed = normalize && _roiBlob->getTensorDesc().getPrecision() == Precision::U8 &&
+                                  outBlob->getTensorDesc().getPrecision() == Precision::FP32;
+
+    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW && !normalize_needed) {
+       THROW_IE_EXCEPTION << "Input pre-processing is called without the pre-processing info set: "
+                             "there's nothing to be done";
+    }
+
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
+    const auto normalization = normalize_needed ? getNormalization(info, outBlob) : PreprocEngine::Normalization{};
+
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+    if (info.getLetterbox()) {
+        executeLetterbox(outBlob, info, serial, batchSize, normalization);
+        return;
+    }
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize, normalization)) {
         return;
     }
 
@@ -833,6 +995,16 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
                               "formats.";
     }
 
+    // In this mode the result is normalized in a separate pass after the resize
+    Blob::Ptr res_dst = outBlob;
+    if (normalize_needed) {
+        if (!_tmp3 || _tmp3->size() != outBlob->size()) {
+            _tmp3 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+            _tmp3->allocate();
+        }
+        res_dst = _tmp3;
+    }
+
     Blob::Ptr res_in, res_out;
     if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
         if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
@@ -853,32 +1025,93 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         res_in = _roiBlob;
     }
 
-    if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp2 || _tmp2->size() != outBlob->size()) {
-            if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+    if (res_dst->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp2 || _tmp2->size() != res_dst->size()) {
+            if (res_dst->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp2 = make_shared_blob<float>({Precision::FP32, res_dst->getTensorDesc().getDims(), Layout::NCHW});
             } else {
-                _tmp2 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+                _tmp2 = make_shared_blob<uint8_t>({Precision::U8, res_dst->getTensorDesc().getDims(), Layout::NCHW});
             }
             _tmp2->allocate();
         }
         res_out = _tmp2;
     } else {
-        res_out = outBlob;
+        res_out = res_dst;
     }
 
     {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Resize");
-        resize(res_in, res_out, algorithm);
+        if (algorithm == NO_RESIZE) {
+            blob_copy(res_in, res_out);
+        } else {
+            resize(res_in, res_out, algorithm);
+        }
     }
 
     if (res_out == _tmp2) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Reorder after");
-        blob_copy(_tmp2, outBlob);
+        blob_copy(_tmp2, res_dst);
+    }
+
+    if (res_dst == _tmp3) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Normalize");
+        normalizeBlob(_tmp3, outBlob, normalization);
     }
 }
 
+void PreProcessData::executeRois(const Blob::Ptr &src, const std::vector<ROI> &rois, Blob::Ptr &outBlob,
+        const PreProcessInfo& info, bool serial, bool normalize) {
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing ROIs");
+
+    if (src == nullptr) {
+        THROW_IE_EXCEPTION << "Input pre-processing of ROIs is called without source blob";
+    }
+    if (rois.empty() || rois.size() > outBlob->getTensorDesc().getDims()[0]) {
+        THROW_IE_EXCEPTION << "Number of ROIs " << rois.size() << " is invalid, expected from 1 to "
+                           << outBlob->getTensorDesc().getDims()[0] << " (batch size of the output blob)";
+    }
+
+    const bool normalize_needed = normalize && src->getTensorDesc().getPrecision() == Precision::U8 &&
+                                  outBlob->getTensorDesc().getPrecision() == Precision::FP32;
+    const auto normalization = normalize_needed ? getNormalization(info, outBlob) : PreprocEngine::Normalization{};
+
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine);
+    }
+    // Letterbox needs its own output ROI per crop, so such crops are processed one by one
+    if (!info.getLetterbox() &&
+        _preproc->preprocessRoisWithGAPI(src, rois, outBlob, info.getResizeAlgorithm(), info.getColorFormat(),
+                                         serial, normalization)) {
+        return;
+    }
+
+    // In this mode crops are processed one by one
+    const auto& dims = outBlob->getTensorDesc().getDims();
+    const auto roiBlob = _roiBlob;
+    for (size_t i = 0; i < rois.size(); i++) {
+        _roiBlob = src->createROI(rois[i]);
+        auto slot = outBlob->createROI(ROI(i, 0, 0, dims[3], dims[2]));
+        execute(slot, info, serial, -1, normalize);
+    }
+    _roiBlob = roiBlob;
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    // every region is pre-processed into its own batch slot of the network input
+    if (auto rois = src->as<ROIsBlob>()) {
+        const auto& dst_dims = dst->getTensorDesc().getDims();
+        if (dst_dims.size() != 4)
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Only 4D tensors are supported.";
+        if (rois->rois().size() > dst_dims[0])
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of ROIs " << rois->rois().size()
+                               << " is greater than the network batch size " << dst_dims[0];
+        const auto slot = dst->createROI(ROI(0, 0, 0, dst_dims[3], dst_dims[2]));
+        for (const auto& roi : rois->rois()) {
+            isApplicable(rois->image()->createROI(roi), slot);
+        }
+        return;
+    }
+
     // if G-API pre-processing is used, let it check that pre-processing is applicable
     if (PreprocEngine::useGAPI()) {
         PreprocEngine::checkApplicabilityGAPI(src, dst);
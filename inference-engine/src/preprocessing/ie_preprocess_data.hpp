@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <ie_blob.h>
 #include <ie_profiling.hpp>
@@ -36,7 +37,7 @@ class IPreProcessData : public details::IRelease {
 public:
     /**
      * @brief Sets ROI blob to be resized and placed to the default input blob during pre-processing.
-     * @param blob ROI blob.
+     * @param blob ROI blob. Regions of ROIsBlob are pre-processed by executeRois().
      */
     virtual void setRoiBlob(const Blob::Ptr &blob) = 0;
 
@@ -49,13 +50,36 @@ public:
     /**
      * @brief Executes input pre-processing with a given pre-processing information.
      * @param outBlob pre-processed output blob to be used for inference.
-     * @param info pre-processing info that specifies resize algorithm and color format.
+     * @param info pre-processing info that specifies resize algorithm, color format and normalization.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
+     * @param normalize if the value set to true, U8 ROI blob is converted to FP32 @p outBlob and mean values and
+     * scales from @p info are applied together with the conversion. Otherwise they are left to the caller.
      */
-    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                         bool normalize = false) = 0;
+
+    /**
+     * @brief Executes pre-processing of several crops of one image in a single pass, crop i is placed to the
+     * batch slot i of the output blob. The ROI blob set by setRoiBlob() is not used.
+     * @param src source image blob.
+     * @param rois crops of the source image, ROI::id selects the image in the source batch.
+     * @param outBlob pre-processed output blob with the batch size not less than the number of crops.
+     * @param info pre-processing info that specifies resize algorithm, color format and normalization.
+     * @param serial disable OpenMP threading if the value set to true.
+     * @param normalize apply mean values and scales from @p info, see execute().
+     */
+    virtual void executeRois(const Blob::Ptr &src, const std::vector<ROI> &rois, Blob::Ptr &outBlob,
+                             const PreProcessInfo& info, bool serial, bool normalize = false) = 0;
 
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
+
+    /**
+     * @brief Gets statistics of the cache of compiled pre-processing graphs.
+     * @param hits number of execute() calls which reused a compiled graph.
+     * @param misses number of execute() calls which compiled a graph or reshaped the least recently used one.
+     */
+    virtual void getCacheStats(size_t &hits, size_t &misses) const = 0;
 };
 
 INFERENCE_PRERPOC_PLUGIN_API(StatusCode) CreatePreProcessData(IPreProcessData *& data, ResponseDesc *resp) noexcept;
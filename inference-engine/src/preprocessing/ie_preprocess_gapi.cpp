@@ -10,6 +10,7 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <iterator>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -543,13 +544,38 @@ convertColorPlanar(const std::vector<cv::GMat>& inputs,
     return planes;
 }
 
+// convert planes into the output precision, mean values and scales (if any) are applied in the
+// same pass
+std::vector<cv::GMat> convertPrecision(const std::vector<cv::GMat>& planes,
+                                       int dst_precision,
+                                       const PreprocEngine::Normalization& normalization) {
+    const auto& means  = normalization.first;
+    const auto& scales = normalization.second;
+    if (!means.empty() && means.size() != planes.size()) {
+        THROW_IE_EXCEPTION << "[G-API] internal error: number of mean values != number of planes: "
+                           << means.size() << " != " << planes.size();
+    }
+
+    std::vector<cv::GMat> converted;
+    converted.reserve(planes.size());
+    for (size_t i = 0; i < planes.size(); i++) {
+        if (means.empty() || dst_precision != CV_32F) {
+            converted.push_back(gapi::ConvertDepth::on(planes[i], dst_precision));
+        } else {
+            converted.push_back(gapi::NormalizePlane::on(planes[i], means[i], scales[i]));
+        }
+    }
+    return converted;
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             Layout in_layout,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::Normalization& normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -574,7 +600,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && (in_desc.prec == CV_8U)
+                                        && (out_desc.prec == CV_8U || out_desc.prec == CV_32F)
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -609,6 +636,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (out_desc.prec != in_desc.prec) {
+            planes = convertPrecision(planes, out_desc.prec, normalization);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -642,6 +673,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_NEAREST:  return cv::INTER_NEAREST;
+            case RESIZE_BICUBIC:  return cv::INTER_CUBIC;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -665,15 +698,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     }
 
     if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
-        auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
-            std::vector<cv::GMat> dst_gmats;
-            std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
-                return gapi::ConvertDepth::on(m, dst_precision);
-            });
-            return dst_gmats;
-        };
-
-        outputs = convert_prec(outputs, out_desc.prec);
+        outputs = convertPrecision(outputs, out_desc.prec, normalization);
     }
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
@@ -682,33 +707,51 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+
+// rows of the output plane computed by the slice `slice_n` out of `total_slices`
+cv::gapi::own::Rect sliceRect(const cv::gapi::own::Mat& output_plane, int slice_n, int total_slices) {
+    auto lines_per_thread = output_plane.rows / total_slices;
+    const auto remainder = output_plane.rows % total_slices;
+
+    // remainder shows how many threads must calculate 1 additional row. now these additions
+    // must also be addressed in rect's Y coordinate:
+    int roi_y = 0;
+    if (slice_n < remainder) {
+        lines_per_thread++;  // 1 additional row
+        roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+    } else {
+        // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+        roi_y =
+            remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+    }
+
+    return cv::gapi::own::Rect{0, roi_y, output_plane.cols, lines_per_thread};
+}
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine(size_t cacheCapacity) : _cacheCapacity(std::max<size_t>(cacheCapacity, 1)) {}
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. mean values or scales have changed (kernel parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -724,7 +767,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -823,19 +866,10 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& slices_compiled,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, int thread_num,
     Update update) {
-
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
     // Split the whole graph into `total_slices` slices, where
     // `total_slices` is provided by the parallel runtime and assumed
     // to be number of threads used.  However it is not guaranteed
@@ -845,7 +879,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = slices_compiled[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -856,24 +890,9 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             const auto& input_plane_mats = batched_input_plane_mats[0];
             const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+            const auto roi = sliceRect(output_plane_mats[0], slice_n, total_slices);
+            if (roi.height <= 0) return;  // no job for current thread
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
-
-            if (lines_per_thread <= 0) return;  // no job for current thread
-
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
@@ -906,7 +925,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const Normalization& normalization) {
 
     validateBlob(inBlob);
 
@@ -948,40 +967,69 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
-    const Update update = needUpdate(thisCall);
+                                  algorithm,
+                                  normalization };
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
 
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
+    // to suppress unused warnings
+    (void)(omp_serial);
 
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
+    // Slices of the output depend on the number of threads, so it is a part of the key
+    Update update = Update::NOTHING;
+    auto cached = std::find_if(_cache.begin(), _cache.end(), [&](const CompiledCall& entry) {
+        return entry.thread_num == thread_num && entry.call == thisCall;
+    });
+    if (cached != _cache.end()) {
+        _cacheHits++;
+        _cache.splice(_cache.begin(), _cache, cached);
+    } else {
+        _cacheMisses++;
+        if (_cache.size() < _cacheCapacity) {
+            _cache.push_front(CompiledCall{thisCall, thread_num, std::vector<cv::GCompiled>(parallel_get_max_threads())});
+            update = Update::REBUILD;
+        } else {
+            // The least recently used graph is taken, it is only reshaped if possible
+            _cache.splice(_cache.begin(), _cache, std::prev(_cache.end()));
+            auto& entry = _cache.front();
+            update = entry.thread_num == thread_num ? needUpdate(entry.call, thisCall) : Update::REBUILD;
+            entry.call = thisCall;
+            entry.thread_num = thread_num;
         }
     }
 
+    Opt<cv::GComputation> _lastComputation;
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt,
+                       normalization));
+    }
+
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(_lastComputation, _cache.front().compiled, batched_input_plane_mats, batched_output_plane_mats,
+        batch_size, thread_num, update);
 
     return true;
 }
 
 bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization& normalization) {
     if (!useGAPI()) {
         return false;
     }
@@ -1005,7 +1053,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1014,7 +1062,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 
     default:
@@ -1024,7 +1072,197 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
+    }
+}
+
+template<typename BlobTypePtr>
+bool PreprocEngine::preprocessRois(const BlobTypePtr &inBlob, const std::vector<ROI> &rois,
+    MemoryBlob::Ptr &outBlob, ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt,
+    bool omp_serial, const Normalization& normalization) {
+    using BlobType = typename BlobTypePtr::element_type;
+    using cv::gapi::own::Rect;
+
+    validateBlob(inBlob);
+
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+
+    const auto out_layout = out_desc_ie.getLayout();
+    const G::Desc out_desc = G::decompose(out_desc_ie);
+
+    if (rois.empty() || rois.size() > static_cast<size_t>(out_desc.d.N)) {
+        THROW_IE_EXCEPTION  << "Provided number of ROIs is invalid: (provided) " << rois.size()
+                            << ", expected from 1 to " << out_desc.d.N << " (batch size expected by network)";
+    }
+
+    // crops share the memory of the input image
+    std::vector<BlobTypePtr> roi_blobs;
+    std::vector<std::vector<cv::gapi::own::Mat>> roi_plane_mats;
+    for (const auto& roi : rois) {
+        auto roi_blob = as<BlobType>(inBlob->createROI(roi));
+        if (!roi_blob) {
+            THROW_IE_EXCEPTION << "Failed to create ROI blob for the input image";
+        }
+        validateBlob(roi_blob);
+        validateTensorDesc(getTensorDescAndLayout(roi_blob).first);
+        roi_plane_mats.push_back(std::move(bind_to_blob(roi_blob, 1)[0]));
+        roi_blobs.push_back(std::move(roi_blob));
+    }
+    auto batched_output_plane_mats = bind_to_blob(outBlob, static_cast<int>(rois.size()));
+
+    const auto& in_desc_ie = getTensorDescAndLayout(roi_blobs[0]).first;
+    const auto in_layout = getTensorDescAndLayout(roi_blobs[0]).second;
+    const auto out_slot_dims = SizeVector{1, out_desc_ie.getDims()[1], out_desc_ie.getDims()[2],
+                                          out_desc_ie.getDims()[3]};
+
+    // sizes of crops are not known in advance, so they are not a part of the call
+    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_layout,
+                                            SizeVector{},
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_slot_dims,
+                                            out_fmt },
+                                  algorithm,
+                                  normalization };
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // with the area interpolation up- and downscaled crops need different graphs
+    const auto is_upscale = [&](const SizeVector& in_dims) -> bool {
+        return algorithm == RESIZE_AREA && (in_dims[2] < out_slot_dims[2] || in_dims[3] < out_slot_dims[3]);
+    };
+
+    if (_roisCall.slices.empty() || _roisCall.call != thisCall || _roisCall.thread_num != thread_num) {
+        _roisCall.call = thisCall;
+        _roisCall.thread_num = thread_num;
+        _roisCall.computations[0] = Opt<cv::GComputation>{};
+        _roisCall.computations[1] = Opt<cv::GComputation>{};
+        _roisCall.slices = std::vector<CompiledSlice>(parallel_get_max_threads());
+    }
+    for (const auto& roi_blob : roi_blobs) {
+        const auto& roi_desc_ie = getTensorDescAndLayout(roi_blob).first;
+        auto& computation = _roisCall.computations[is_upscale(roi_desc_ie.getDims())];
+        if (!computation) {
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            auto in_desc = G::decompose(roi_desc_ie);
+            computation = cv::util::make_optional(
+                buildGraph(getGDesc(in_desc, roi_blob),
+                           out_desc,
+                           in_layout,
+                           out_layout,
+                           algorithm,
+                           in_fmt,
+                           out_fmt,
+                           normalization));
+        }
+    }
+
+    parallel_nt_static(thread_num, [&, this](int ithr, const int nthr) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+        // every crop is computed by a group of threads, each thread of the group computes own
+        // row slice of the output. with enough crops a group is a single thread
+        const int crops = static_cast<int>(rois.size());
+        const int slices_per_crop = crops >= nthr ? 1 : nthr / crops;
+        const int groups = nthr / slices_per_crop;
+        const int slice_n = ithr % slices_per_crop;
+
+        auto& slice = _roisCall.slices[ithr];
+        for (int i = ithr / slices_per_crop; i < crops; i += groups) {
+            const auto& input_plane_mats = roi_plane_mats[i];
+            auto& output_plane_mats = batched_output_plane_mats[i];
+
+            const auto rect = sliceRect(output_plane_mats[0], slice_n, slices_per_crop);
+            if (rect.height <= 0) return;  // no job for current thread
+
+            const auto& roi_desc_ie = getTensorDescAndLayout(roi_blobs[i]).first;
+            CallDesc cropCall = thisCall;
+            std::get<2>(std::get<0>(cropCall)) = roi_desc_ie.getDims();
+
+            // the graph is compiled for the size of the crop and reshaped only when the next crop differs
+            auto update = slice.compiled ? needUpdate(slice.call, cropCall) : Update::REBUILD;
+            if (update == Update::NOTHING && slice.rect != rect) {
+                update = Update::RESHAPE;
+            }
+            if (Update::REBUILD == update || Update::RESHAPE == update) {
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+                auto args = cv::compile_args(gapi::preprocKernels(),
+                                             cv::GFluidOutputRois{std::vector<Rect>(output_plane_mats.size(), rect)});
+                if (Update::REBUILD == update) {
+                    auto& computation = _roisCall.computations[is_upscale(roi_desc_ie.getDims())].value();
+                    slice.compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+                } else {
+                    slice.compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                }
+                slice.call = cropCall;
+                slice.rect = rect;
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+            slice.compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+
+    return true;
+}
+
+bool PreprocEngine::preprocessRoisWithGAPI(const Blob::Ptr &inBlob, const std::vector<ROI> &rois,
+        Blob::Ptr &outBlob, const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial,
+        const Normalization& normalization) {
+    if (!useGAPI()) {
+        return false;
+    }
+
+    const auto out_fmt = ColorFormat::BGR;  // FIXME: get expected color format from network
+
+    // output is always a memory blob
+    auto outMemoryBlob = as<MemoryBlob>(outBlob);
+    if (!outMemoryBlob) {
+        THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
+    }
+
+    switch (in_fmt) {
+    case ColorFormat::NV12: {
+        auto inNV12Blob = as<NV12Blob>(inBlob);
+        if (!inNV12Blob) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected NV12Blob";
+        }
+        return preprocessRois(inNV12Blob, rois, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            normalization);
+    }
+    case ColorFormat::I420: {
+        auto inI420Blob = as<I420Blob>(inBlob);
+        if (!inI420Blob) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected I420Blob";
+        }
+        return preprocessRois(inI420Blob, rois, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            normalization);
+    }
+
+    default:
+        auto inMemoryBlob = as<MemoryBlob>(inBlob);
+        if (!inMemoryBlob) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected MemoryBlob";
+        }
+        return preprocessRois(inMemoryBlob, rois, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            normalization);
     }
 }
 }  // namespace InferenceEngine
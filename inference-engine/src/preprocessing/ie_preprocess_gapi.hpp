@@ -8,10 +8,13 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
+#include <opencv2/gapi/own/types.hpp>
 #include <opencv2/gapi/util/optional.hpp>
 #include "ie_profiling.hpp"
 #include <openvino/itt.hpp>
@@ -22,12 +25,46 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    // Mean values and scales per output channel, applied when the output is converted to FP32
+    using Normalization = std::pair<std::vector<float>, std::vector<float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graph compiled for a call, one object per slice of the output
+    struct CompiledCall {
+        CallDesc call;
+        int thread_num;
+        std::vector<cv::GCompiled> compiled;
+    };
+
+    // Most recently used calls first, so that switching between a few input
+    // resolutions does not recompile the graph on every call
+    std::list<CompiledCall> _cache;
+    size_t _cacheCapacity;
+    size_t _cacheHits = 0;
+    size_t _cacheMisses = 0;
+
+    // Graph compiled for a row slice of the output for crops of a single image
+    struct CompiledSlice {
+        CallDesc call;
+        cv::gapi::own::Rect rect;
+        cv::GCompiled compiled;
+    };
+
+    // Graph for crops of a single image. Crops have different sizes, so the sizes are not a part
+    // of the call and every thread keeps own object reshaped for the crop it computes. Graphs for
+    // downscaled and upscaled crops differ in case of the area interpolation
+    struct CompiledRoisCall {
+        CallDesc call;
+        int thread_num = 0;
+        Opt<cv::GComputation> computations[2];
+        std::vector<CompiledSlice> slices;
+    };
+    CompiledRoisCall _roisCall;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -35,27 +72,42 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiled,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
-                      bool omp_serial,
+                      int thread_num,
                       Update update);
 
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const Normalization& normalization);
+
+    template<typename BlobTypePtr>
+    bool preprocessRois(const BlobTypePtr &inBlob, const std::vector<ROI> &rois, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        const Normalization& normalization);
 
 public:
-    PreprocEngine();
+    explicit PreprocEngine(size_t cacheCapacity = 4);
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     bool preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const Normalization& normalization = {});
+    // Crops `rois` of the input image, crop i is resized into the batch slot i of the output. All crops
+    // are processed in one parallel pass
+    bool preprocessRoisWithGAPI(const Blob::Ptr &inBlob, const std::vector<ROI> &rois, Blob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, bool omp_serial,
+        const Normalization& normalization = {});
+
+    // Numbers of calls which reused a compiled graph and which compiled or reshaped one
+    size_t cacheHits() const { return _cacheHits; }
+    size_t cacheMisses() const { return _cacheMisses; }
 };
 
 }  // namespace InferenceEngine
@@ -812,10 +812,47 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+G_TYPED_KERNEL(ScalePlaneNearest, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
+// Bi-cubic resize is done in three stages, as the fluid resize window
+// doesn't provide the 4 input lines the vertical pass needs:
+//  - horizontal pass, the result is always 32F to keep precision
+//  - CubicRows, which makes 4 copies of the plane shifted by -1, 0, +1, +2 lines
+//  - vertical pass, which takes a single line from each copy
+G_TYPED_KERNEL(HScalePlaneCubic, <cv::GMat(cv::GMat, int)>, "com.intel.ie.hscale_plane_cubic") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, int width) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withDepth(CV_32F).withSize(Size(width, in.size.height));
+    }
+};
+
+G_TYPED_KERNEL_M(CubicRows, <GMat4(cv::GMat)>, "com.intel.ie.cubic_rows") {
+    static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(const cv::GMatDesc& in) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return std::make_tuple(in, in, in, in);
+    }
+};
+
+G_TYPED_KERNEL(VScalePlaneCubic, <cv::GMat(cv::GMat, cv::GMat, cv::GMat, cv::GMat, Size, int)>,
+               "com.intel.ie.vscale_plane_cubic") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const cv::GMatDesc&, const cv::GMatDesc&,
+                                const cv::GMatDesc&, const Size &sz, int depth) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        GAPI_DbgAssert(depth == CV_8U || depth == CV_32F);
+        return in.withDepth(depth).withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp ||
+                       cv::INTER_NEAREST == interp || cv::INTER_CUBIC == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -842,6 +879,17 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_NEAREST == interp) {
+            return ScalePlaneNearest::on(in, szOut, interp);
+        }
+
+        if (cv::INTER_CUBIC == interp) {
+            cv::GMat rows[4];
+            std::tie(rows[0], rows[1], rows[2], rows[3]) = CubicRows::on(HScalePlaneCubic::on(in, szOut.width));
+            return VScalePlaneCubic::on(rows[0], rows[1], rows[2], rows[3], szOut,
+                                     CV_8UC1 == type ? CV_8U : CV_32F);
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -2380,6 +2428,517 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+template<typename T>
+static void normalizeRow(const uint8_t* in, float mean, float scale, float* out, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::normalizeRow_8U(in, out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::normalizeRow_8U(in, out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            normalizeRow_8U(in, out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        neon::normalizeRow_8U(in, out, mean, scale, length);
+        return;
+    }
+
+    if (std::is_same<T, float>::value) {
+        neon::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_NEON
+
+    const auto inT = reinterpret_cast<const T*>(in);
+    for (int x = 0; x < length; x++) {
+        out[x] = (static_cast<float>(inT[x]) - mean) * scale;
+    }
+}
+
+// Precision conversion and normalization are done in one pass, so the network's input
+// is written only once
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F);
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto rowFunc = (src.meta().depth == CV_8U) ? &normalizeRow<uint8_t> : &normalizeRow<float>;
+        rowFunc(src.InLineB(0), mean, scale, dst.OutLine<float>(), dst.length());
+    }
+};
+
+//----------------------------------------------------------------------
+
+template<typename T>
+static void calcRowNearest(const T in[], T out[], const int mapsx[], int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::calcRowNearest_8U(reinterpret_cast<const uint8_t*>(in),
+                                      reinterpret_cast<uint8_t*>(out), mapsx, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowNearest_32F(reinterpret_cast<const float*>(in),
+                                       reinterpret_cast<float*>(out), mapsx, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::calcRowNearest_8U(reinterpret_cast<const uint8_t*>(in),
+                                   reinterpret_cast<uint8_t*>(out), mapsx, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowNearest_32F(reinterpret_cast<const float*>(in),
+                                    reinterpret_cast<float*>(out), mapsx, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            calcRowNearest_8U(reinterpret_cast<const uint8_t*>(in),
+                              reinterpret_cast<uint8_t*>(out), mapsx, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            calcRowNearest_32F(reinterpret_cast<const float*>(in),
+                               reinterpret_cast<float*>(out), mapsx, length);
+            return;
+        }
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        neon::calcRowNearest_8U(reinterpret_cast<const uint8_t*>(in),
+                                reinterpret_cast<uint8_t*>(out), mapsx, length);
+        return;
+    }
+
+    if (std::is_same<T, float>::value) {
+        neon::calcRowNearest_32F(reinterpret_cast<const float*>(in),
+                                 reinterpret_cast<float*>(out), mapsx, length);
+        return;
+    }
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = in[mapsx[x]];
+    }
+}
+
+struct nearestScratchDesc {
+    int* mapsx;
+    int* mapsy;
+
+    nearestScratchDesc(int outW, int /*outH*/, void* data) {
+        mapsx = reinterpret_cast<int*>(data);
+        mapsy = mapsx + outW;
+    }
+
+    static int bufSize(int outW, int outH) {
+        return static_cast<int>((outW + outH) * sizeof(int));
+    }
+};
+
+// Nearest input pixel is the first one of the fluid downscale window,
+// so the input line is always within the window the view provides
+static inline int nearestMap(double ratio, int outCoord, int inSz) {
+    return (std::min)(static_cast<int>(outCoord * ratio + 1e-3), inSz - 1);
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest, ScalePlaneNearest, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        cv::GMatDesc desc;
+        desc.chan = 1;
+        desc.depth = CV_8UC1;
+        desc.size = Size(nearestScratchDesc::bufSize(outSz.width, outSz.height), 1);
+
+        cv::gapi::fluid::Buffer buffer(desc);
+        scratch = std::move(buffer);
+
+        nearestScratchDesc scr(outSz.width, outSz.height, scratch.OutLineB());
+
+        const double hRatio = ratio(in.size.width, outSz.width);
+        const double vRatio = ratio(in.size.height, outSz.height);
+
+        for (int x = 0; x < outSz.width; x++) {
+            scr.mapsx[x] = nearestMap(hRatio, x, in.size.width);
+        }
+
+        for (int y = 0; y < outSz.height; y++) {
+            scr.mapsy[y] = nearestMap(vRatio, y, in.size.height);
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const auto outSz = out.meta().size;
+        nearestScratchDesc scr(outSz.width, outSz.height, scratch.OutLineB());
+
+        const int inY = in.y();
+        const int outY = out.y();
+
+        for (int l = 0; l < out.lpi(); l++) {
+            const int index = scr.mapsy[outY + l] - inY;
+            if (in.meta().depth == CV_8U) {
+                calcRowNearest(in.InLine<uint8_t>(index), out.OutLine<uint8_t>(l), scr.mapsx, out.length());
+            } else {
+                calcRowNearest(in.InLine<float>(index), out.OutLine<float>(l), scr.mapsx, out.length());
+            }
+        }
+    }
+};
+
+//----------------------------------------------------------------------
+
+static void calcRowCubicH(const float in[], float out[], const int mapsx[], const float alpha[], int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        calcRowCubicH_32F(in, out, mapsx, alpha, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = in[mapsx[x]]              * alpha[x]              +
+                 in[mapsx[length + x]]     * alpha[length + x]     +
+                 in[mapsx[2 * length + x]] * alpha[2 * length + x] +
+                 in[mapsx[3 * length + x]] * alpha[3 * length + x];
+    }
+}
+
+template<typename T>
+static void calcRowCubicV(const float* in[], T out[], const float beta[], int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::calcRowCubicV_8U(in, reinterpret_cast<uint8_t*>(out), beta, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowCubicV_32F(in, reinterpret_cast<float*>(out), beta, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::calcRowCubicV_8U(in, reinterpret_cast<uint8_t*>(out), beta, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowCubicV_32F(in, reinterpret_cast<float*>(out), beta, length);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            calcRowCubicV_8U(in, reinterpret_cast<uint8_t*>(out), beta, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            calcRowCubicV_32F(in, reinterpret_cast<float*>(out), beta, length);
+            return;
+        }
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        neon::calcRowCubicV_8U(in, reinterpret_cast<uint8_t*>(out), beta, length);
+        return;
+    }
+
+    if (std::is_same<T, float>::value) {
+        neon::calcRowCubicV_32F(in, reinterpret_cast<float*>(out), beta, length);
+        return;
+    }
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = saturate_cast<T>(in[0][x] * beta[0] + in[1][x] * beta[1] +
+                                  in[2][x] * beta[2] + in[3][x] * beta[3]);
+    }
+}
+
+// Same coefficients as cv::resize() uses for INTER_CUBIC
+static inline void cubicCoeffs(float x, float coeffs[4]) {
+    constexpr float A = -0.75f;
+
+    coeffs[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+    coeffs[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+    coeffs[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+    coeffs[3] = 1.f - coeffs[0] - coeffs[1] - coeffs[2];
+}
+
+struct cubicHScratchDesc {
+    int*   mapsx;
+    float* alpha;
+    float* tmp;
+
+    cubicHScratchDesc(int /*inW*/, int outW, void* data) {
+        mapsx = reinterpret_cast<int*>(data);
+        alpha = reinterpret_cast<float*>(mapsx + 4*outW);
+        tmp   = alpha + 4*outW;
+    }
+
+    static int bufSize(int inW, int outW) {
+        return static_cast<int>(4*outW * sizeof(int) + 4*outW * sizeof(float) + inW * sizeof(float));
+    }
+};
+
+GAPI_FLUID_KERNEL(FHScalePlaneCubic, HScalePlaneCubic, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in, int outW,
+                            cv::gapi::fluid::Buffer &scratch) {
+        const int inW = in.size.width;
+
+        cv::GMatDesc desc;
+        desc.chan = 1;
+        desc.depth = CV_8UC1;
+        desc.size = Size(cubicHScratchDesc::bufSize(inW, outW), 1);
+
+        cv::gapi::fluid::Buffer buffer(desc);
+        scratch = std::move(buffer);
+
+        cubicHScratchDesc scr(inW, outW, scratch.OutLineB());
+
+        const double hRatio = ratio(inW, outW);
+        for (int x = 0; x < outW; x++) {
+            const double sx = (x + 0.5) * hRatio - 0.5;
+            const int ix = static_cast<int>(std::floor(sx));
+
+            float coeffs[4];
+            cubicCoeffs(static_cast<float>(sx - ix), coeffs);
+
+            for (int k = 0; k < 4; k++) {
+                scr.mapsx[k*outW + x] = (std::min)((std::max)(ix + k - 1, 0), inW - 1);
+                scr.alpha[k*outW + x] = coeffs[k];
+            }
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, int /*outW*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const int inW = in.meta().size.width;
+        cubicHScratchDesc scr(inW, out.length(), scratch.OutLineB());
+
+        // input and output have the same height, so line l of the window is line l of the output
+        for (int l = 0; l < out.lpi(); l++) {
+            const float* src = nullptr;
+            if (in.meta().depth == CV_8U) {
+                normalizeRow<uint8_t>(in.InLine<uint8_t>(l), 0.f, 1.f, scr.tmp, inW);
+                src = scr.tmp;
+            } else {
+                src = in.InLine<float>(l);
+            }
+
+            calcRowCubicH(src, out.OutLine<float>(l), scr.mapsx, scr.alpha, out.length());
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FCubicRows, CubicRows, false) {
+    static const int Window = 5;
+
+    static void run(const cv::gapi::fluid::View& in,
+                    cv::gapi::fluid::Buffer& out0,
+                    cv::gapi::fluid::Buffer& out1,
+                    cv::gapi::fluid::Buffer& out2,
+                    cv::gapi::fluid::Buffer& out3) {
+        cv::gapi::fluid::Buffer* out[4] = {&out0, &out1, &out2, &out3};
+        for (int k = 0; k < 4; k++) {
+            chanToPlaneRow<float>(in.InLineB(k - 1), 0, 1, out[k]->OutLineB(), in.length());
+        }
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/) {
+        return {cv::BORDER_REPLICATE, {}};
+    }
+};
+
+struct cubicVScratchDesc {
+    int*   mapsy;
+    float* beta;
+
+    cubicVScratchDesc(int outH, void* data) {
+        mapsy = reinterpret_cast<int*>(data);
+        beta  = reinterpret_cast<float*>(mapsy + outH);
+    }
+
+    static int bufSize(int outH) {
+        return static_cast<int>(outH * sizeof(int) + 4*outH * sizeof(float));
+    }
+};
+
+GAPI_FLUID_KERNEL(FVScalePlaneCubic, VScalePlaneCubic, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in, const cv::GMatDesc&, const cv::GMatDesc&,
+                            const cv::GMatDesc&, Size outSz, int /*depth*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        const int inH = in.size.height;
+        const int outH = outSz.height;
+
+        cv::GMatDesc desc;
+        desc.chan = 1;
+        desc.depth = CV_8UC1;
+        desc.size = Size(cubicVScratchDesc::bufSize(outH), 1);
+
+        cv::gapi::fluid::Buffer buffer(desc);
+        scratch = std::move(buffer);
+
+        cubicVScratchDesc scr(outH, scratch.OutLineB());
+
+        const double vRatio = ratio(inH, outH);
+        for (int y = 0; y < outH; y++) {
+            const double sy = (y + 0.5) * vRatio - 0.5;
+            const int iy = static_cast<int>(std::floor(sy));
+
+            // Line b is read from the 4 shifted copies, so lines b-1..b+2 (replicated at the
+            // borders) are available. b must stay within the fluid resize window of line y.
+            int b = (std::min)((std::max)(iy, 0), inH - 1);
+            if (vRatio >= 1.0) {
+                b = (std::max)(b, static_cast<int>(y * vRatio + 1e-3));
+            }
+            scr.mapsy[y] = b;
+
+            float coeffs[4];
+            cubicCoeffs(static_cast<float>(sy - iy), coeffs);
+
+            float* beta = scr.beta + 4*y;
+            std::fill(beta, beta + 4, 0.f);
+            for (int k = 0; k < 4; k++) {
+                const int line = (std::min)((std::max)(iy + k - 1, 0), inH - 1);
+                const int j = (std::min)((std::max)(line - b + 1, 0), 3);
+                beta[j] += coeffs[k];
+            }
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in0, const cv::gapi::fluid::View& in1,
+                    const cv::gapi::fluid::View& in2, const cv::gapi::fluid::View& in3,
+                    Size /*sz*/, int /*depth*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        cubicVScratchDesc scr(out.meta().size.height, scratch.OutLineB());
+
+        const int inY = in0.y();
+        const int outY = out.y();
+
+        for (int l = 0; l < out.lpi(); l++) {
+            const int index = scr.mapsy[outY + l] - inY;
+            const float* src[4] = {in0.InLine<float>(index), in1.InLine<float>(index),
+                                   in2.InLine<float>(index), in3.InLine<float>(index)};
+            const float* beta = scr.beta + 4*(outY + l);
+
+            if (out.meta().depth == CV_8U) {
+                calcRowCubicV(src, out.OutLine<uint8_t>(l), beta, out.length());
+            } else {
+                calcRowCubicV(src, out.OutLine<float>(l), beta, out.length());
+            }
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2398,6 +2957,10 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneNearest
+        , FHScalePlaneCubic
+        , FCubicRows
+        , FVScalePlaneCubic
         , FMerge2
         , FMerge3
         , FMerge4
@@ -2407,6 +2970,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalizePlane
         >();
 }
 
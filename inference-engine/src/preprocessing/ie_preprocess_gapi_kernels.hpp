@@ -152,6 +152,15 @@ namespace gapi {
         }
     };
 
+    // Subtracts the mean value and multiplies by the scale, the result is always 32F
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float, float)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float /*mean*/, float /*scale*/) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+            return in.withDepth(CV_32F);
+        }
+    };
+
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -2,6 +2,7 @@
 #define IE_PREPROCESS_GAPI_KERNELS_SIMD_IMPL_H
 
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 
 #include "ie_preprocess_gapi_kernels_impl.hpp"
@@ -783,6 +784,182 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+// Normalization: out = (in - mean) * scale, also converts the input to 32F
+inline void normalizeRow_8U_impl(const uint8_t in[], float out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    const auto normalize = [&](int x) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[x])));
+        vx_store(&out[x], (r - vmean) * vscale);
+    };
+
+    for (; l <= length - nlanes; l += nlanes) {
+        normalize(l);
+    }
+
+    if (l < length && length >= nlanes) {
+        normalize(length - nlanes);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+inline void normalizeRow_32F_impl(const float in[], float out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], (vx_load(&in[l]) - vmean) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        vx_store(&out[length - nlanes], (vx_load(&in[length - nlanes]) - vmean) * vscale);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (in[l] - mean) * scale;
+    }
+}
+
+// Resize (nearest neighbor): out[x] = in[mapsx[x]]
+template<typename T>
+inline void calcRowNearest_impl(const T in[], T out[], const int mapsx[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    using VecT = typename std::conditional<std::is_same<T, uint8_t>::value, v_uint8, v_float32>::type;
+    const int nlanes = VecT::nlanes;
+
+    for (; x <= length - nlanes; x += nlanes) {
+        vx_store(&out[x], vx_lut(in, &mapsx[x]));
+    }
+
+    if (x < length && length >= nlanes) {
+        vx_store(&out[length - nlanes], vx_lut(in, &mapsx[length - nlanes]));
+        x = length;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[x] = in[mapsx[x]];
+    }
+}
+
+// Resize (bi-cubic, horizontal pass): out[x] = sum(alpha[k*length + x] * in[mapsx[k*length + x]]), k=0..3
+inline void calcRowCubicH_32F_impl(const float in[], float out[], const int mapsx[], const float alpha[],
+                                   int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    const auto cubic = [&](int l) {
+        v_float32 r = vx_lut(in, &mapsx[l]) * vx_load(&alpha[l]);
+        r = v_fma(vx_lut(in, &mapsx[length + l]),     vx_load(&alpha[length + l]),     r);
+        r = v_fma(vx_lut(in, &mapsx[2 * length + l]), vx_load(&alpha[2 * length + l]), r);
+        r = v_fma(vx_lut(in, &mapsx[3 * length + l]), vx_load(&alpha[3 * length + l]), r);
+        vx_store(&out[l], r);
+    };
+
+    for (; x <= length - nlanes; x += nlanes) {
+        cubic(x);
+    }
+
+    if (x < length && length >= nlanes) {
+        cubic(length - nlanes);
+        x = length;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[x] = in[mapsx[x]]              * alpha[x]              +
+                 in[mapsx[length + x]]     * alpha[length + x]     +
+                 in[mapsx[2 * length + x]] * alpha[2 * length + x] +
+                 in[mapsx[3 * length + x]] * alpha[3 * length + x];
+    }
+}
+
+// Resize (bi-cubic, vertical pass): out = sum(beta[k] * in[k]), k=0..3
+inline void calcRowCubicV_32F_impl(const float* in[], float out[], const float beta[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 b0 = vx_setall_f32(beta[0]), b1 = vx_setall_f32(beta[1]);
+    const v_float32 b2 = vx_setall_f32(beta[2]), b3 = vx_setall_f32(beta[3]);
+
+    const auto cubic = [&](int l) {
+        v_float32 r = vx_load(&in[0][l]) * b0;
+        r = v_fma(vx_load(&in[1][l]), b1, r);
+        r = v_fma(vx_load(&in[2][l]), b2, r);
+        r = v_fma(vx_load(&in[3][l]), b3, r);
+        vx_store(&out[l], r);
+    };
+
+    for (; x <= length - nlanes; x += nlanes) {
+        cubic(x);
+    }
+
+    if (x < length && length >= nlanes) {
+        cubic(length - nlanes);
+        x = length;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[x] = in[0][x] * beta[0] + in[1][x] * beta[1] + in[2][x] * beta[2] + in[3][x] * beta[3];
+    }
+}
+
+inline void calcRowCubicV_8U_impl(const float* in[], uint8_t out[], const float beta[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_int16::nlanes;
+    const int half = v_float32::nlanes;
+    const v_float32 b0 = vx_setall_f32(beta[0]), b1 = vx_setall_f32(beta[1]);
+    const v_float32 b2 = vx_setall_f32(beta[2]), b3 = vx_setall_f32(beta[3]);
+
+    const auto cubic = [&](int l) {
+        v_float32 r = vx_load(&in[0][l]) * b0;
+        r = v_fma(vx_load(&in[1][l]), b1, r);
+        r = v_fma(vx_load(&in[2][l]), b2, r);
+        r = v_fma(vx_load(&in[3][l]), b3, r);
+        return v_round(r);
+    };
+
+    for (; x <= length - nlanes; x += nlanes) {
+        v_pack_u_store(&out[x], v_pack(cubic(x), cubic(x + half)));
+    }
+
+    if (x < length && length >= nlanes) {
+        x = length - nlanes;
+        v_pack_u_store(&out[x], v_pack(cubic(x), cubic(x + half)));
+        x = length;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[x] = saturate_cast<uint8_t>(in[0][x] * beta[0] + in[1][x] * beta[1] +
+                                        in[2][x] * beta[2] + in[3][x] * beta[3]);
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
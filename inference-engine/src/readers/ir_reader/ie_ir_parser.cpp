@@ -7,6 +7,7 @@
 #include <typeinfo>
 #include <unordered_set>
 #include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
@@ -23,6 +24,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "ie_blob_stream.hpp"
@@ -1259,6 +1261,20 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
+    // Refer to weights of a memory mapped .bin file instead of copying them. User blobs are copied
+    // as the user may change them after reading. Weights at offsets without the 64 byte alignment
+    // of Constant data are copied as well, since operations may rely on that alignment
+    static constexpr size_t constantAlignment = 64;
+    auto blobStream = details::BlobStream::fromStream(binStream);
+    if (blobStream != nullptr && blobStream->isShareable()) {
+        auto weights = blobStream->getBlob();
+        char* data = weights->cbuffer().as<char*>() + offset;
+        if (reinterpret_cast<std::uintptr_t>(data) % constantAlignment == 0) {
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weights);
+            return std::make_shared<ngraph::op::Constant>(port.precision, shape, buffer);
+        }
+    }
+
     auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
     char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
     binStream.seekg(offset, std::ios::beg);
@@ -37,17 +37,6 @@ public:
 };
 
 std::shared_ptr<ICNNNetwork> CNNParser::parse(const pugi::xml_node& root, std::istream& binStream) {
-    auto getBlobStream = [](std::istream& binStream) {
-        details::BlobStream* blobStream = dynamic_cast<details::BlobStream*>(&binStream);
-        if (blobStream == nullptr) {
-            details::BlobStream helper({});
-            std::string typeStream = typeid(binStream).name();
-            std::string typeBlobStream = typeid(helper).name();
-            if (typeStream == typeBlobStream)
-                blobStream = static_cast<details::BlobStream*>(&binStream);
-        }
-        return blobStream;
-    };
     details::CNNNetReaderImpl reader(std::make_shared<details::V2FormatParserCreator>());
     ResponseDesc resp;
     StatusCode ret = reader.ReadNetwork(root, &resp);
@@ -56,7 +45,7 @@ std::shared_ptr<ICNNNetwork> CNNParser::parse(const pugi::xml_node& root, std::i
     TBlob<uint8_t>::Ptr weightsPtr;
 
     // Try to get BlobStream to work with original blob
-    details::BlobStream* blobStream = getBlobStream(binStream);
+    details::BlobStream* blobStream = details::BlobStream::fromStream(binStream);
     if (blobStream != nullptr) {
         weightsPtr = std::make_shared<WeightsHolderBlob>(blobStream->getBlob());
     } else {
@@ -22,12 +22,27 @@ private:
 
     BlobBuffer buffer;
     Blob::CPtr blob;
+    bool shareable = false;
 
 public:
     BlobStream(const Blob::CPtr& blob);
+    /**
+     * @brief Creates a stream over a blob which readers may refer to instead of copying its data.
+     *        It is used only for blobs owned by Inference Engine, e.g. memory mapped weights files,
+     *        since user blobs may be modified or have no alignment required by operations
+     */
+    BlobStream(const Blob::CPtr& blob, bool shareable);
     ~BlobStream() override;
 
     Blob::CPtr getBlob();
+    bool isShareable() const;
+
+    /**
+     * @brief Returns the BlobStream behind a stream or nullptr if it is another stream.
+     *        The types are compared by name as well, since dynamic_cast fails if the stream
+     *        was created in another shared library
+     */
+    static BlobStream* fromStream(std::istream& stream);
 };
 
 
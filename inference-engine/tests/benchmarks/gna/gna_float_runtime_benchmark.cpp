@@ -0,0 +1,143 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <runtime/gna_float_runtime.hpp>
+
+using namespace GNAPluginNS::runtime;
+
+// output rows, input rows and columns (batch) of the component
+struct ComponentShape {
+    uint32_t rowsOut;
+    uint32_t rowsIn;
+    uint32_t columns;
+};
+
+namespace {
+
+// shapes of affine, diagonal and recurrent components of speech_sample models (wsj_dnn5b, rm_lstm4f, rm_cnn4a)
+const std::vector<ComponentShape> speechShapes = {
+    {2048, 440, 8},
+    {2048, 2048, 8},
+    {3425, 2048, 8},
+    {1024, 1272, 1},
+    {512, 512, 4},
+    {1536, 512, 1},
+    {33, 35, 3},
+};
+
+std::vector<float> randomVector(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> result(size);
+    for (auto& value : result) {
+        value = dist(gen);
+    }
+    return result;
+}
+
+// Average time of one call after a warm-up call, which brings the weights into caches as a running model would
+template <typename F>
+int measureNanoseconds(const F& func, int repeats) {
+    func();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+        func();
+    }
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    return static_cast<int>(duration.count() / repeats);
+}
+
+std::string toString(const ComponentShape& shape) {
+    return std::to_string(shape.rowsOut) + "x" + std::to_string(shape.rowsIn) + "x" + std::to_string(shape.columns);
+}
+
+}  // namespace
+
+class GNAFloatRuntimeBenchmark : public ::testing::TestWithParam<ComponentShape> {
+protected:
+    intel_dnn_component_t makeComponent(intel_dnn_operation_t operation, uint32_t rowsIn, uint32_t columnsIn,
+                                        uint32_t rowsOut, uint32_t columnsOut) {
+        intel_dnn_component_t component{};
+        component.operation = operation;
+        component.num_rows_in = rowsIn;
+        component.num_columns_in = columnsIn;
+        component.num_rows_out = rowsOut;
+        component.num_columns_out = columnsOut;
+        component.num_bytes_per_input = sizeof(float);
+        component.num_bytes_per_output = sizeof(float);
+        return component;
+    }
+
+    std::mt19937 gen{42};
+    const int repeats = 10;
+};
+
+// C = A * B + bias of an affine layer, A is rowsOut x rowsIn, B is rowsIn x columns
+TEST_P(GNAFloatRuntimeBenchmark, affine) {
+    auto shape = GetParam();
+    auto weights = randomVector(shape.rowsOut * shape.rowsIn, gen);
+    auto biases = randomVector(shape.rowsOut, gen);
+    auto inputs = randomVector(shape.rowsIn * shape.columns, gen);
+    std::vector<float> outputs(shape.rowsOut * shape.columns);
+
+    auto component = makeComponent(kDnnAffineOp, shape.rowsIn, shape.columns, shape.rowsOut, shape.columns);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+
+    RecordProperty("shape", toString(shape));
+    RecordProperty("time_ns", measureNanoseconds([&] { FP::ApplyAffineTransform(&component, nullptr, 0); }, repeats));
+}
+
+// Element-wise scaling of each column by a diagonal matrix of rowsOut coefficients
+TEST_P(GNAFloatRuntimeBenchmark, diagonal) {
+    auto shape = GetParam();
+    auto weights = randomVector(shape.rowsOut, gen);
+    auto biases = randomVector(shape.rowsOut, gen);
+    auto inputs = randomVector(shape.rowsOut * shape.columns, gen);
+    std::vector<float> outputs(shape.rowsOut * shape.columns);
+
+    auto component = makeComponent(kDnnDiagonalOp, shape.rowsOut, shape.columns, shape.rowsOut, shape.columns);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+
+    RecordProperty("shape", toString(shape));
+    RecordProperty("time_ns", measureNanoseconds([&] { FP::ApplyDiagonalTransform(&component); }, repeats));
+}
+
+// One time step of a recurrent layer: rowsOut outputs from rowsIn inputs and rowsOut feedbacks,
+// all time steps of the batch are timed as the float runtime runs them one by one
+TEST_P(GNAFloatRuntimeBenchmark, recurrent) {
+    auto shape = GetParam();
+    auto weights = randomVector(shape.rowsOut * (shape.rowsIn + shape.rowsOut), gen);
+    auto biases = randomVector(shape.rowsOut, gen);
+    auto inputs = randomVector(shape.columns * shape.rowsIn, gen);
+    auto feedbacks = randomVector(shape.rowsOut, gen);
+    std::vector<float> outputs(shape.columns * shape.rowsOut);
+
+    auto component = makeComponent(kDnnRecurrentOp, shape.columns, shape.rowsIn, shape.columns, shape.rowsOut);
+    component.op.recurrent.ptr_weights = weights.data();
+    component.op.recurrent.ptr_biases = biases.data();
+    component.op.recurrent.ptr_feedbacks = feedbacks.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+
+    RecordProperty("shape", toString(shape));
+    RecordProperty("time_ns", measureNanoseconds([&] {
+        for (uint32_t row = 0; row < shape.columns; row++) {
+            FP::ApplyRecurrentTransform(&component, row, feedbacks.data());
+        }
+    }, repeats));
+}
+
+INSTANTIATE_TEST_CASE_P(SpeechComponents, GNAFloatRuntimeBenchmark, ::testing::ValuesIn(speechShapes));
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace InferenceEngine;
+
+class CPUStreamsExecutorBenchmark : public ::testing::TestWithParam<int> {};
+
+// Measures empty-task throughput of the executor, so the queueing overhead is the only cost
+TEST_P(CPUStreamsExecutorBenchmark, emptyTasksThroughput) {
+    const int streams = GetParam();
+    const int PRODUCERS_NUMBER = 4;
+    const int TASKS_PER_PRODUCER = 25000;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                             streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::atomic_int executed = {0};
+    std::promise<void> allDone;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCERS_NUMBER; i++) {
+        producers.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_PRODUCER; k++) {
+                taskExecutor->run([&] {
+                    if (++executed == PRODUCERS_NUMBER * TASKS_PER_PRODUCER) allDone.set_value();
+                });
+            }
+        });
+    }
+    for (auto&& producer : producers) producer.join();
+    allDone.get_future().wait();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(PRODUCERS_NUMBER * TASKS_PER_PRODUCER, executed);
+    RecordProperty("tasks_per_second", static_cast<int>(PRODUCERS_NUMBER * TASKS_PER_PRODUCER / elapsed.count()));
+}
+
+INSTANTIATE_TEST_CASE_P(CPUStreamsExecutorBenchmark, CPUStreamsExecutorBenchmark,
+                        ::testing::Values(1, 2, 4, 8, 16, 32));
@@ -2,7 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
+#include <ngraph/op/constant.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include "ngraph_reader_tests.hpp"
 
@@ -53,3 +59,133 @@ TEST_F(NGraphReaderTests, ReadConstantNetwork) {
 
         IE_SUPPRESS_DEPRECATED_END
 }
+
+namespace {
+
+const std::string constantWithOffsetModel = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant" type="Const" version="opset1">
+            <data offset="16" size="48"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+std::shared_ptr<ngraph::op::Constant> getConstant(const CNNNetwork& network) {
+    for (auto&& node : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node))
+            return constant;
+    }
+    return nullptr;
+}
+
+// Replaces the 16 bytes offset of the constant in constantWithOffsetModel
+std::string getConstantModel(size_t offset) {
+    std::string model = constantWithOffsetModel;
+    const std::string attribute = "offset=\"16\"";
+    return model.replace(model.find(attribute), attribute.size(), "offset=\"" + std::to_string(offset) + "\"");
+}
+
+#ifdef __linux__
+// Checks that the pointer refers to a memory mapping of the file listed in /proc/self/maps
+bool isInsideFileMapping(const void* ptr, const std::string& fileName) {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::string suffix = "/" + fileName;
+    std::ifstream maps("/proc/self/maps");
+    for (std::string line; std::getline(maps, line);) {
+        if (line.size() < suffix.size() || line.compare(line.size() - suffix.size(), suffix.size(), suffix) != 0)
+            continue;
+        std::uintptr_t begin = 0, end = 0;
+        char dash = 0;
+        std::istringstream(line) >> std::hex >> begin >> dash >> end;
+        if (begin <= address && address < end)
+            return true;
+    }
+    return false;
+}
+#endif
+
+// Reads the constant from a .bin file which is mapped into memory, its weights are 32 consecutive floats
+void readConstantFromMappedFile(size_t offset, bool shared) {
+    const std::string modelPath = "ReadConstantNetworkFromMappedFile.xml";
+    const std::string weightsPath = "ReadConstantNetworkFromMappedFile.bin";
+    {
+        std::ofstream(modelPath) << getConstantModel(offset);
+        std::ofstream weightsFile(weightsPath, std::ios::binary);
+        for (size_t i = 0; i < 32; i++) {
+            auto value = static_cast<float>(i);
+            weightsFile.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+    }
+
+    std::vector<float> data;
+    {
+        Core ie;
+        auto constant = getConstant(ie.ReadNetwork(modelPath));
+        ASSERT_NE(nullptr, constant);
+#ifdef __linux__
+        ASSERT_EQ(shared, isInsideFileMapping(constant->get_data_ptr(), weightsPath));
+#endif
+        data = constant->get_vector<float>();
+    }
+    std::remove(modelPath.c_str());
+    std::remove(weightsPath.c_str());
+
+    ASSERT_EQ(12, data.size());
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(static_cast<float>(i + offset / sizeof(float)), data[i]);
+}
+
+}  // namespace
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkCopiesWeightsBlob) {
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<float>(TensorDesc(Precision::FP32, {16}, Layout::C));
+    weights->allocate();
+    auto values = weights->buffer().as<float*>();
+    for (size_t i = 0; i < weights->size(); i++)
+        values[i] = static_cast<float>(i);
+
+    auto network = ie.ReadNetwork(constantWithOffsetModel, weights);
+    auto constant = getConstant(network);
+    ASSERT_NE(nullptr, constant);
+    ASSERT_NE(values + 4, constant->get_data_ptr<float>());
+
+    // constant does not depend on the user blob
+    values[4] = -1.f;
+    weights.reset();
+    auto data = constant->get_vector<float>();
+    ASSERT_EQ(12, data.size());
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(static_cast<float>(i + 4), data[i]);
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkFromMappedFileSharesAlignedWeights) {
+    readConstantFromMappedFile(64, true);
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkFromMappedFileCopiesMisalignedWeights) {
+    readConstantFromMappedFile(16, false);
+}
@@ -3,6 +3,11 @@
 //
 
 #include <future>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -212,3 +217,99 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+// More tasks than a stream queue holds, so a part of them goes to the overflow queue
+static constexpr const std::size_t NUMBER_OF_OVERFLOWING_TASKS = 3000;
+
+static CPUStreamsExecutor::Ptr makeStreamsExecutor(int streams) {
+    return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+}
+
+TEST(CPUStreamsExecutorTests, oneStreamRunsTasksInSubmissionOrderAfterOverflow) {
+    auto taskExecutor = makeStreamsExecutor(1);
+    std::promise<void> unblock, firstStarted, resume;
+    auto unblocked = unblock.get_future().share();
+    auto resumed = resume.get_future().share();
+    taskExecutor->run([unblocked] { unblocked.wait(); });
+    std::vector<std::size_t> order;
+    std::promise<void> allDone;
+    auto runTask = [&] (std::size_t i) {
+        taskExecutor->run([&, i] {
+            order.push_back(i);
+            if (0 == i) {
+                firstStarted.set_value();
+                resumed.wait();
+            }
+            if (NUMBER_OF_OVERFLOWING_TASKS == order.size()) allDone.set_value();
+        });
+    };
+    for (std::size_t i = 0; i < NUMBER_OF_OVERFLOWING_TASKS / 2; i++) {
+        runTask(i);
+    }
+    // The stream queue has free cells now, but the tasks submitted later should not overtake the overflowed ones
+    unblock.set_value();
+    firstStarted.get_future().wait();
+    for (std::size_t i = NUMBER_OF_OVERFLOWING_TASKS / 2; i < NUMBER_OF_OVERFLOWING_TASKS; i++) {
+        runTask(i);
+    }
+    resume.set_value();
+    ASSERT_EQ(std::future_status::ready, allDone.get_future().wait_for(std::chrono::seconds(10)));
+    for (std::size_t i = 0; i < NUMBER_OF_OVERFLOWING_TASKS; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST(CPUStreamsExecutorTests, allTasksAreExecutedOnceAfterOverflow) {
+    const int streams = 4;
+    auto taskExecutor = makeStreamsExecutor(streams);
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    for (int i = 0; i < streams; i++) {
+        taskExecutor->run([unblocked] { unblocked.wait(); });
+    }
+    std::vector<std::atomic_int> executed(streams * NUMBER_OF_OVERFLOWING_TASKS);
+    for (auto&& counter : executed) counter = 0;
+    std::atomic<std::size_t> total = {0};
+    std::promise<void> allDone;
+    for (std::size_t i = 0; i < executed.size(); i++) {
+        taskExecutor->run([&, i] {
+            ++executed[i];
+            if (executed.size() == ++total) allDone.set_value();
+        });
+    }
+    unblock.set_value();
+    ASSERT_EQ(std::future_status::ready, allDone.get_future().wait_for(std::chrono::seconds(10)));
+    for (auto&& counter : executed) {
+        ASSERT_EQ(1, counter);
+    }
+}
+
+TEST(CPUStreamsExecutorTests, idleStreamStealsTasksOfBusyStream) {
+    const std::size_t tasksNumber = 100;
+    auto taskExecutor = makeStreamsExecutor(2);
+    std::promise<std::thread::id> blockedThread;
+    std::promise<void> allDone;
+    auto done = allDone.get_future().share();
+    std::future_status blockedTaskStatus = std::future_status::timeout;
+    // The task occupies its stream until all other tasks are done, including the ones queued to its stream
+    auto blockedTask = async(taskExecutor, [&] {
+        blockedThread.set_value(std::this_thread::get_id());
+        blockedTaskStatus = done.wait_for(std::chrono::seconds(10));
+    });
+    auto blockedThreadId = blockedThread.get_future().get();
+    std::mutex mutex;
+    std::vector<std::thread::id> threadIds;
+    for (std::size_t i = 0; i < tasksNumber; i++) {
+        taskExecutor->run([&] {
+            std::lock_guard<std::mutex> lock{mutex};
+            threadIds.push_back(std::this_thread::get_id());
+            if (tasksNumber == threadIds.size()) allDone.set_value();
+        });
+    }
+    blockedTask.wait();
+    ASSERT_EQ(std::future_status::ready, blockedTaskStatus);
+    for (auto&& threadId : threadIds) {
+        ASSERT_NE(blockedThreadId, threadId);
+    }
+}
@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cpu/cpu_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -24,7 +25,17 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TRACE, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TRACE, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_PLANNER, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_PLANNER, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, InferenceEngine::PluginConfigParams::NO}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +70,12 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TRACE, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_PLANNER, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES, "OFF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
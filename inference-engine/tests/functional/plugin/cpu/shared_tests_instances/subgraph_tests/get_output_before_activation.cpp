@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include <subgraph_tests/get_output_before_activation.hpp>
 #include "common_test_utils/test_constants.hpp"
+#include "cpu/cpu_config.hpp"
 
 namespace SubgraphTestsDefinitions {
 namespace {
@@ -18,7 +19,12 @@ namespace {
         midOutputType::Sum
     };
 
-    std::map<std::string, std::string> additional_config = {};
+    std::vector<std::map<std::string, std::string>> additional_config = {
+        {},
+        {{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES}},
+        {{InferenceEngine::CPUConfigParams::KEY_CPU_POOLED_WORKSPACE, InferenceEngine::PluginConfigParams::YES},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}
+    };
 } // namespace
 
 INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
@@ -27,6 +33,6 @@ INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
         ::testing::Values(InferenceEngine::Precision::FP32),
         ::testing::ValuesIn(input_sizes),
         ::testing::ValuesIn(midLayerTypes),
-        ::testing::Values(additional_config)),
+        ::testing::ValuesIn(additional_config)),
     OutputBeforeActivation::getTestCaseName);
 } // namespace SubgraphTestsDefinitions
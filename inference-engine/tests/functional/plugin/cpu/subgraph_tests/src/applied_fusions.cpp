@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using ngraph::helpers::ActivationTypes;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::vector<ActivationTypes>,   // Activations applied to the convolution output
+        bool,                           // Convolution output is a network output as well
+        std::string,                    // Expected fusion pattern
+        size_t,                         // Expected number of fusions with the pattern
+        std::string                     // Device name
+> AppliedFusionsTuple;
+
+class AppliedFusionsTest : public testing::WithParamInterface<AppliedFusionsTuple>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AppliedFusionsTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        std::vector<ActivationTypes> activations;
+        bool convolutionIsOutput;
+        std::string pattern;
+        size_t count;
+        std::string targetName;
+        std::tie(inputShape, activations, convolutionIsOutput, pattern, count, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Activations=" << activations.size() << "_";
+        results << "ConvOut=" << convolutionIsOutput << "_";
+        results << "Fusion=" << pattern << "_";
+        results << "Count=" << count << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::vector<ActivationTypes> activations;
+        bool convolutionIsOutput;
+        std::tie(inputShape, activations, convolutionIsOutput, expectedPattern, expectedCount, targetDevice) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+
+        std::shared_ptr<ngraph::Node> last = convolution;
+        for (auto activation : activations) {
+            last = ngraph::builder::makeActivation(last, ngraph::element::f32, activation);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(last)};
+        if (convolutionIsOutput) {
+            results.push_back(std::make_shared<ngraph::opset1::Result>(convolution));
+        }
+        function = std::make_shared<ngraph::Function>(results, params, "applied_fusions");
+    }
+
+    std::string expectedPattern;
+    size_t expectedCount = 0;
+};
+
+TEST_P(AppliedFusionsTest, ReportsAppliedFusionPatterns) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::vector<std::string> metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_APPLIED_FUSIONS)));
+
+    std::map<std::string, uint64_t> fusions = executableNetwork.GetMetric(METRIC_KEY(CPU_APPLIED_FUSIONS));
+    auto fusion = fusions.find(expectedPattern);
+    if (expectedCount == 0) {
+        ASSERT_EQ(fusions.end(), fusion);
+    } else {
+        ASSERT_NE(fusions.end(), fusion);
+        ASSERT_EQ(expectedCount, fusion->second);
+    }
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 8, 10, 10},
+        {2, 3, 7, 9},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_AppliedFusions_SingleActivation, AppliedFusionsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(std::vector<ActivationTypes>{ActivationTypes::Relu}),
+                                ::testing::Values(false),
+                                ::testing::Values("Convolution+ReLU"),
+                                ::testing::Values(1),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        AppliedFusionsTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_AppliedFusions_ActivationChain, AppliedFusionsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(std::vector<ActivationTypes>{ActivationTypes::Relu, ActivationTypes::Sigmoid}),
+                                ::testing::Values(false),
+                                ::testing::Values("Convolution+ReLU+Sigmoid"),
+                                ::testing::Values(1),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        AppliedFusionsTest::getTestCaseName);
+
+// the convolution output has two consumers, so the activation stays a separate node
+INSTANTIATE_TEST_CASE_P(smoke_AppliedFusions_SharedConvolutionOutput, AppliedFusionsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(std::vector<ActivationTypes>{ActivationTypes::Relu}),
+                                ::testing::Values(true),
+                                ::testing::Values("Convolution+ReLU"),
+                                ::testing::Values(0),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        AppliedFusionsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,119 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        bool,                           // Tracing enabled
+        size_t,                         // Number of infer requests
+        std::string                     // Device name
+> ChromeTraceTuple;
+
+class ChromeTraceTest : public testing::WithParamInterface<ChromeTraceTuple>,
+                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ChromeTraceTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        bool trace;
+        size_t numRequests;
+        std::string targetName;
+        std::tie(inputShape, trace, numRequests, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Trace=" << trace << "_";
+        results << "Requests=" << numRequests << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::tie(inputShape, trace, numRequests, targetDevice) = this->GetParam();
+        if (trace) {
+            configuration[InferenceEngine::CPUConfigParams::KEY_CPU_TRACE] = InferenceEngine::PluginConfigParams::YES;
+        }
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        auto pooling = ngraph::builder::makePooling(convolution, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(pooling)};
+        function = std::make_shared<ngraph::Function>(results, params, "chrome_trace");
+    }
+
+    size_t countOf(const std::string &json, const std::string &pattern) const {
+        size_t count = 0;
+        for (auto pos = json.find(pattern); pos != std::string::npos; pos = json.find(pattern, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    bool trace = false;
+    size_t numRequests = 0;
+};
+
+TEST_P(ChromeTraceTest, RecordsOneInferenceEventPerRequest) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (!trace) {
+        ASSERT_THROW(executableNetwork.GetMetric(METRIC_KEY(CPU_TRACE)), InferenceEngine::details::InferenceEngineException);
+        return;
+    }
+
+    // the first request was created and inferred by Run()
+    for (size_t i = 1; i < numRequests; i++) {
+        auto request = executableNetwork.CreateInferRequest();
+        auto inputInfo = executableNetwork.GetInputsInfo().begin();
+        request.SetBlob(inputInfo->first, inputs[0]);
+        request.Infer();
+    }
+
+    std::string json = executableNetwork.GetMetric(METRIC_KEY(CPU_TRACE));
+    ASSERT_EQ(0u, json.find("{\"traceEvents\":[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"));
+    ASSERT_EQ(numRequests, countOf(json, "\"cat\":\"Inference\",\"ph\":\"X\""));
+    ASSERT_GE(countOf(json, "\"cat\":\"Convolution\",\"ph\":\"X\""), numRequests);
+    ASSERT_GE(countOf(json, "\"cat\":\"Pooling\",\"ph\":\"X\""), numRequests);
+    for (size_t i = 0; i < numRequests; i++) {
+        ASSERT_NE(std::string::npos, json.find("\"args\":{\"request\":" + std::to_string(i) + "}")) << i;
+    }
+    const std::string end = "],\"displayTimeUnit\":\"ns\"}";
+    ASSERT_EQ(json.size() - end.size(), json.rfind(end));
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 3, 16, 16},
+        {2, 8, 9, 12},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ChromeTrace, ChromeTraceTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(true, false),
+                                ::testing::Values(1, 3),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ChromeTraceTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
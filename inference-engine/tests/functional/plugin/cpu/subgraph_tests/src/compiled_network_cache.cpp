@@ -0,0 +1,207 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/file_util.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+class CompiledNetworkCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        initialFiles = listCacheFiles();
+        network = InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+        input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    }
+
+    void TearDown() override {
+        for (auto&& file : newCacheFiles()) {
+            CommonTestUtils::removeFile(file);
+        }
+    }
+
+    std::set<std::string> listCacheFiles() const {
+        std::set<std::string> files;
+        ngraph::file_util::iterate_files(cacheDir, [&](const std::string& file, bool isDir) {
+            auto ext = ngraph::file_util::get_file_ext(file);
+            if (!isDir && (ext == ".blob" || ext == ".tmp")) {
+                files.insert(file);
+            }
+        });
+        return files;
+    }
+
+    // Cache entries and temporary files created by the test
+    std::set<std::string> newCacheFiles() const {
+        std::set<std::string> files;
+        for (auto&& file : listCacheFiles()) {
+            if (initialFiles.count(file) == 0) {
+                files.insert(file);
+            }
+        }
+        return files;
+    }
+
+    std::string readFile(const std::string& fileName) const {
+        std::ifstream file(fileName, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void writeFile(const std::string& fileName, const std::string& content) const {
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    std::string infer(InferenceEngine::ExecutableNetwork executableNetwork) const {
+        auto request = executableNetwork.CreateInferRequest();
+        request.SetBlob(executableNetwork.GetInputsInfo().begin()->first, input);
+        request.Infer();
+        auto output = InferenceEngine::as<InferenceEngine::MemoryBlob>(
+            request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first));
+        auto memory = output->rmap();
+        return {memory.as<const char*>(), output->byteSize()};
+    }
+
+    // Names and implementation types of the nodes in the execution order
+    static std::vector<std::pair<std::string, std::string>> primitives(InferenceEngine::ExecutableNetwork executableNetwork) {
+        std::vector<std::pair<std::string, std::string>> result;
+        auto execFunction = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& op : execFunction->get_ordered_ops()) {
+            const auto& rtInfo = op->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+            if (it == rtInfo.end())
+                continue;
+            auto implType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            result.emplace_back(op->get_friendly_name(), implType ? implType->get() : "");
+        }
+        return result;
+    }
+
+    const std::string cacheDir = ".";
+    const std::map<std::string, std::string> cacheConfig = {
+        {InferenceEngine::PluginConfigParams::KEY_CACHE_DIR, cacheDir}};
+    std::set<std::string> initialFiles;
+    InferenceEngine::CNNNetwork network;
+    InferenceEngine::Blob::Ptr input;
+};
+
+TEST_F(CompiledNetworkCacheTest, SecondLoadIsImportedFromCache) {
+    InferenceEngine::Core ie;
+    auto reference = infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, cacheConfig));
+    auto entries = newCacheFiles();
+    ASSERT_EQ(1u, entries.size());
+    auto entry = *entries.begin();
+    ASSERT_EQ(".blob", ngraph::file_util::get_file_ext(entry));
+
+    // The same topology with other random weights gets its own entry
+    InferenceEngine::CNNNetwork otherNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    auto otherReference = infer(ie.LoadNetwork(otherNetwork, CommonTestUtils::DEVICE_CPU, cacheConfig));
+    ASSERT_NE(reference, otherReference);
+    entries = newCacheFiles();
+    ASSERT_EQ(2u, entries.size());
+    entries.erase(entry);
+    auto otherEntry = *entries.begin();
+
+    // Entries are looked up by the network hash, so after the other entry is replaced
+    // the other network produces results of the first one only if it is imported rather than compiled
+    writeFile(otherEntry, readFile(entry));
+    ASSERT_EQ(reference, infer(ie.LoadNetwork(otherNetwork, CommonTestUtils::DEVICE_CPU, cacheConfig)));
+    ASSERT_EQ(reference, infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, cacheConfig)));
+    ASSERT_EQ(2u, newCacheFiles().size());
+}
+
+// The selected primitives and the memory placement are stored in the entry and reused by the import
+TEST_F(CompiledNetworkCacheTest, ImportedNetworkKeepsCompiledPrimitivesAndWorkspace) {
+    InferenceEngine::Core ie;
+    auto config = cacheConfig;
+    config[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+    auto compiled = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ(1u, newCacheFiles().size());
+    auto imported = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+
+    ASSERT_EQ(primitives(compiled), primitives(imported));
+    uint64_t workspaceSize = compiled.GetMetric(METRIC_KEY(CPU_WORKSPACE_SIZE));
+    uint64_t importedWorkspaceSize = imported.GetMetric(METRIC_KEY(CPU_WORKSPACE_SIZE));
+    ASSERT_EQ(workspaceSize, importedWorkspaceSize);
+    ASSERT_EQ(infer(compiled), infer(imported));
+}
+
+TEST_F(CompiledNetworkCacheTest, CorruptedEntryIsCompiledAgainAndOverwritten) {
+    InferenceEngine::Core ie;
+    ie.SetConfig(cacheConfig);
+    auto reference = infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    auto entries = newCacheFiles();
+    ASSERT_EQ(1u, entries.size());
+    auto entry = *entries.begin();
+    auto content = readFile(entry);
+
+    for (auto&& corrupted : {std::string("not a compiled network"), content.substr(0, content.size() / 2)}) {
+        writeFile(entry, corrupted);
+        ASSERT_EQ(reference, infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU)));
+        ASSERT_EQ(entries, newCacheFiles());
+        ASSERT_EQ(content.size(), readFile(entry).size());
+    }
+}
+
+TEST_F(CompiledNetworkCacheTest, DeviceWithoutImportExportIsNotCached) {
+    InferenceEngine::Core ie;
+    std::string heteroDevice = std::string(CommonTestUtils::DEVICE_HETERO) + ":" + CommonTestUtils::DEVICE_CPU;
+    auto reference = infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    ASSERT_EQ(reference, infer(ie.LoadNetwork(network, heteroDevice, cacheConfig)));
+    ASSERT_TRUE(newCacheFiles().empty());
+}
+
+// Import does not restore the support of other input shapes, so such networks are not exported
+TEST_F(CompiledNetworkCacheTest, DynamicShapesNetworkIsNotCached) {
+    InferenceEngine::Core ie;
+    auto config = cacheConfig;
+    config[InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES] = InferenceEngine::PluginConfigParams::YES;
+    auto reference = infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    ASSERT_EQ(reference, infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config)));
+    ASSERT_TRUE(newCacheFiles().empty());
+}
+
+TEST_F(CompiledNetworkCacheTest, FailedWriteDoesNotFailLoadNetwork) {
+    InferenceEngine::Core ie;
+    auto reference = infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    // The temporary file cannot be created in a missing directory
+    auto missingDir = CommonTestUtils::makePath(cacheDir, "missing_cache_dir");
+    ASSERT_EQ(reference, infer(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                              {{InferenceEngine::PluginConfigParams::KEY_CACHE_DIR, missingDir}})));
+    ASSERT_TRUE(newCacheFiles().empty());
+}
+
+TEST_F(CompiledNetworkCacheTest, CacheDirIsNotSetForOneDevice) {
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.SetConfig(cacheConfig, CommonTestUtils::DEVICE_CPU),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(CompiledNetworkCacheTest, ExportNeedsNetworkLoadedForExport) {
+    InferenceEngine::Core ie;
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    std::stringstream networkModel;
+    ASSERT_THROW(executableNetwork.Export(networkModel), InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,200 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <ngraph/graph_util.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,                // Network input shape
+        std::vector<InferenceEngine::SizeVector>,   // Input shapes inferred by the loaded network
+        bool,                                       // Dynamic shapes enabled
+        std::string                                 // Device name
+> DynamicShapesTuple;
+
+class DynamicShapesTest : public testing::WithParamInterface<DynamicShapesTuple>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicShapesTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        std::vector<InferenceEngine::SizeVector> otherShapes;
+        bool dynamic;
+        std::string targetName;
+        std::tie(inputShape, otherShapes, dynamic, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        for (size_t i = 0; i < otherShapes.size(); i++) {
+            results << "OtherIS" << i << "=" << CommonTestUtils::vec2str(otherShapes[i]) << "_";
+        }
+        results << "Dynamic=" << dynamic << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    // output spatial dimensions follow the input ones through the strided pooling
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::tie(inputShape, otherShapes, dynamic, targetDevice) = this->GetParam();
+        if (dynamic) {
+            configuration[InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES] = InferenceEngine::PluginConfigParams::YES;
+        }
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+        auto relu = ngraph::builder::makeActivation(convolution, ngraph::element::f32, ngraph::helpers::ActivationTypes::Relu);
+        auto pooling = ngraph::builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(pooling)};
+        function = std::make_shared<ngraph::Function>(results, params, "dynamic_shapes");
+    }
+
+    // the network reshaped to the given input dimensions and loaded again
+    InferenceEngine::CNNNetwork reshapedNetwork(const InferenceEngine::SizeVector &shape) const {
+        InferenceEngine::CNNNetwork network(ngraph::clone_function(*function));
+        network.reshape({{network.getInputsInfo().begin()->first, shape}});
+        return network;
+    }
+
+    std::vector<InferenceEngine::SizeVector> otherShapes;
+    bool dynamic = false;
+};
+
+TEST_P(DynamicShapesTest, OtherDimensionsMatchReshapedNetwork) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    if (!dynamic) {
+        for (auto &shape : otherShapes) {
+            if (shape == inputs[0]->getTensorDesc().getDims())
+                continue;
+            auto input = FuncTestUtils::createAndFillBlob({InferenceEngine::Precision::FP32, shape, InferenceEngine::Layout::NCHW});
+            ASSERT_THROW(inferRequest.SetBlob(inputName, input), InferenceEngine::details::InferenceEngineException);
+        }
+        return;
+    }
+
+    // the second round takes the compiled networks from the cache
+    for (int round = 0; round < 2; round++) {
+        for (auto &shape : otherShapes) {
+            auto network = reshapedNetwork(shape);
+            auto refRequest = core->LoadNetwork(network, targetDevice).CreateInferRequest();
+
+            auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+            refRequest.SetBlob(inputName, input);
+            refRequest.Infer();
+            inferRequest.SetBlob(inputName, input);
+            inferRequest.Infer();
+
+            for (auto &&output : network.getOutputsInfo()) {
+                auto blob = inferRequest.GetBlob(output.first);
+                ASSERT_EQ(output.second->getTensorDesc().getDims(), blob->getTensorDesc().getDims());
+                FuncTestUtils::compareBlobs(blob, refRequest.GetBlob(output.first));
+            }
+        }
+    }
+}
+
+TEST_P(DynamicShapesTest, OnlyPluginOutputsAreReallocated) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // networks loaded without dynamic shapes reject other dimensions, see OtherDimensionsMatchReshapedNetwork
+    if (!dynamic)
+        return;
+    LoadNetwork();
+
+    auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto network = reshapedNetwork(otherShapes.front());
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    const auto &outputDesc = network.getOutputsInfo().begin()->second->getTensorDesc();
+
+    // the output blob allocated by the plugin is replaced by the one of the new dimensions
+    auto request = executableNetwork.CreateInferRequest();
+    auto pluginOutput = request.GetBlob(outputName);
+    request.SetBlob(inputName, input);
+    request.Infer();
+    ASSERT_NE(pluginOutput, request.GetBlob(outputName));
+    ASSERT_EQ(outputDesc.getDims(), request.GetBlob(outputName)->getTensorDesc().getDims());
+
+    // the output blob set by the user is never replaced
+    request = executableNetwork.CreateInferRequest();
+    request.SetBlob(outputName, pluginOutput);
+    request.SetBlob(inputName, input);
+    ASSERT_THROW(request.Infer(), InferenceEngine::details::InferenceEngineException);
+
+    auto userOutput = FuncTestUtils::createAndFillBlob(outputDesc);
+    request.SetBlob(outputName, userOutput);
+    request.Infer();
+    ASSERT_EQ(userOutput, request.GetBlob(outputName));
+}
+
+// graphs of all streams compiled for the same shapes share the reshaped network, plan and weights
+TEST_P(DynamicShapesTest, AllStreamsMatchReshapedNetwork) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!dynamic)
+        return;
+    configuration[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+    LoadNetwork();
+
+    auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    for (auto &shape : otherShapes) {
+        auto network = reshapedNetwork(shape);
+        auto refRequest = core->LoadNetwork(network, targetDevice).CreateInferRequest();
+        auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+        refRequest.SetBlob(inputName, input);
+        refRequest.Infer();
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (size_t i = 0; i < 4; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            requests.back().SetBlob(inputName, input);
+            requests.back().StartAsync();
+        }
+        for (auto &request : requests) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            for (auto &&output : network.getOutputsInfo()) {
+                FuncTestUtils::compareBlobs(request.GetBlob(output.first), refRequest.GetBlob(output.first));
+            }
+        }
+    }
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> otherShapes = {
+        {1, 4, 24, 24},
+        {2, 4, 16, 32},
+        {1, 4, 20, 20},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_DynamicShapes, DynamicShapesTest,
+                        ::testing::Combine(
+                                ::testing::Values(InferenceEngine::SizeVector{1, 4, 20, 20},
+                                                  InferenceEngine::SizeVector{1, 4, 15, 17}),
+                                ::testing::Values(otherShapes),
+                                ::testing::Values(true, false),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        DynamicShapesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
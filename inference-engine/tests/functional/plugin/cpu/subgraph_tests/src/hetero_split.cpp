@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_cnn_network.h>
+#include <legacy/cnn_network_impl.hpp>
+#include <legacy/details/ie_cnn_network_tools.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+class HeteroSplitTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU0");
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU1");
+    }
+
+    static std::shared_ptr<ngraph::Node> makeConv(const ngraph::Output<ngraph::Node>& in, size_t channels,
+                                                  const std::string& name) {
+        auto conv = ngraph::builder::makeConvolution(in, ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, channels);
+        conv->set_friendly_name(name);
+        return conv;
+    }
+
+    // The ReLU goes to CPU1 and every other layer goes to CPU0, so the layers of CPU0 that are fed both
+    // directly from "a0" and through the ReLU can not form one subgraph
+    static std::shared_ptr<ngraph::Function> makeBypassedRelu(size_t bypassChannels, size_t tailLength) {
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 8, 8, 8}});
+        auto a0 = makeConv(params[0], 8, "a0");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(a0);
+        auto a1 = makeConv(a0, bypassChannels, "a1");
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{a1, relu}, 1);
+        concat->set_friendly_name("a2");
+        std::shared_ptr<ngraph::Node> tail = concat;
+        for (size_t i = 0; i < tailLength; i++) {
+            tail = makeConv(tail, 8, "a" + std::to_string(3 + i));
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(tail)};
+        return std::make_shared<ngraph::Function>(results, params, "BypassedRelu");
+    }
+
+    // The splitter runs for networks without an nGraph function only
+    static InferenceEngine::CNNNetwork makeLegacyNetwork(const std::shared_ptr<ngraph::Function>& function) {
+        auto network = std::make_shared<InferenceEngine::details::CNNNetworkImpl>(InferenceEngine::CNNNetwork(function));
+        for (auto&& layer : InferenceEngine::details::CNNNetSortTopologically(*network)) {
+            layer->affinity = layer->type == "ReLU" ? "CPU1" : "CPU0";
+        }
+        return InferenceEngine::CNNNetwork(network);
+    }
+
+    // Runs the network on HETERO and on CPU alone, returns the subgraph of each layer
+    std::map<std::string, std::string> inferAndGetSubgraphs(const InferenceEngine::CNNNetwork& network) {
+        auto inputInfo = network.getInputsInfo().begin()->second;
+        auto outputName = network.getOutputsInfo().begin()->first;
+        auto input = FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc());
+
+        auto refRequest = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        refRequest.SetBlob(inputInfo->name(), input);
+        refRequest.Infer();
+
+        auto request = ie.LoadNetwork(network, heteroDevice,
+            {{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}})
+            .CreateInferRequest();
+        request.SetBlob(inputInfo->name(), input);
+        request.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), refRequest.GetBlob(outputName));
+
+        // Performance counters are named "subgraph<index>: <layer name>"
+        std::map<std::string, std::string> subgraphs;
+        for (auto&& counter : request.GetPerformanceCounts()) {
+            auto separator = counter.first.find(": ");
+            if (separator != std::string::npos) {
+                subgraphs[counter.first.substr(separator + 2)] = counter.first.substr(0, separator);
+            }
+        }
+        return subgraphs;
+    }
+
+    InferenceEngine::Core ie;
+    const std::string heteroDevice = "HETERO:CPU0,CPU1";
+};
+
+// CPU0 candidates are {input, a0, a1} and {a1, a2, a3, a4}, the larger one is taken first
+TEST_F(HeteroSplitTest, LargestSubgraphIsSelected) {
+    auto subgraphs = inferAndGetSubgraphs(makeLegacyNetwork(makeBypassedRelu(8, 2)));
+    ASSERT_EQ(subgraphs.at("a1"), subgraphs.at("a4"));
+    ASSERT_NE(subgraphs.at("a0"), subgraphs.at("a1"));
+}
+
+// CPU0 candidates {input, a0, a1} and {a1, a2, a3} are of the same size, the first one has the cheaper
+// border as "a1" produces one channel, while the second one reads both eight channel outputs of "a0" and the ReLU
+TEST_F(HeteroSplitTest, SubgraphWithCheaperBorderIsSelected) {
+    auto subgraphs = inferAndGetSubgraphs(makeLegacyNetwork(makeBypassedRelu(1, 1)));
+    ASSERT_EQ(subgraphs.at("a0"), subgraphs.at("a1"));
+    ASSERT_NE(subgraphs.at("a1"), subgraphs.at("a3"));
+}
+
+// The I64 boundary is an I32 output of the producer, the consumer input takes this precision to share the blob
+TEST_F(HeteroSplitTest, IntegerBoundaryTakesPrecisionOfProducer) {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 4, 8, 8}});
+    auto toInteger = std::make_shared<ngraph::opset1::Convert>(params[0], ngraph::element::i64);
+    auto toFloat = std::make_shared<ngraph::opset1::Convert>(toInteger, ngraph::element::f32);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(toFloat)};
+    auto function = std::make_shared<ngraph::Function>(results, params, "IntegerBoundary");
+    toInteger->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>("CPU0");
+    toFloat->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>("CPU1");
+
+    InferenceEngine::CNNNetwork network(function);
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc());
+
+    auto refRequest = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    refRequest.SetBlob(inputInfo->name(), input);
+    refRequest.Infer();
+
+    auto request = ie.LoadNetwork(network, heteroDevice).CreateInferRequest();
+    request.SetBlob(inputInfo->name(), input);
+    request.Infer();
+    FuncTestUtils::compareBlobs(request.GetBlob(outputName), refRequest.GetBlob(outputName));
+}
+
+}  // namespace CPULayerTestsDefinitions
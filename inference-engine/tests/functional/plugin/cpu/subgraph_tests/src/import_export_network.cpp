@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <sstream>
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::Precision,         // Input precision
+        std::map<std::string, std::string>  // Configuration
+> importExportNetworkParams;
+
+class ImportExportNetworkTest : public testing::WithParamInterface<importExportNetworkParams>,
+                                public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<importExportNetworkParams> obj) {
+        InferenceEngine::Precision inputPrecision;
+        std::map<std::string, std::string> config;
+        std::tie(inputPrecision, config) = obj.param;
+
+        std::ostringstream result;
+        result << "inPRC=" << inputPrecision.name();
+        for (auto&& configItem : config) {
+            result << "_" << configItem.first << "=" << configItem.second;
+        }
+        return result.str();
+    }
+
+    void Run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        LoadNetwork();
+        Infer();
+        Validate();
+        const auto actualOutputs = GetOutputs();
+
+        std::stringstream networkModel;
+        executableNetwork.Export(networkModel);
+        auto importedNetwork = core->ImportNetwork(networkModel, targetDevice, configuration);
+
+        ASSERT_EQ(executableNetwork.GetInputsInfo().size(), importedNetwork.GetInputsInfo().size());
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            auto importedInput = importedNetwork.GetInputsInfo().find(input.first);
+            ASSERT_NE(importedNetwork.GetInputsInfo().end(), importedInput);
+            ASSERT_EQ(input.second->getTensorDesc(), importedInput->second->getTensorDesc());
+        }
+
+        auto importedRequest = importedNetwork.CreateInferRequest();
+        size_t i = 0;
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            importedRequest.SetBlob(input.first, inputs[i++]);
+        }
+        importedRequest.Infer();
+
+        i = 0;
+        ASSERT_EQ(executableNetwork.GetOutputsInfo().size(), importedNetwork.GetOutputsInfo().size());
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            auto importedOutput = importedRequest.GetBlob(output.first);
+            ASSERT_EQ(actualOutputs[i]->getTensorDesc(), importedOutput->getTensorDesc());
+            auto actualMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(actualOutputs[i++])->rmap();
+            auto importedMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(importedOutput)->rmap();
+            ASSERT_EQ(0, std::memcmp(actualMemory.as<const void*>(), importedMemory.as<const void*>(),
+                                     importedOutput->byteSize()));
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::tie(inPrc, configuration) = this->GetParam();
+        function = ngraph::builder::subgraph::makeSplitConvConcat();
+    }
+};
+
+TEST_P(ImportExportNetworkTest, CompareWithRefs) {
+    Run();
+};
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> inputPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::U8
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK, InferenceEngine::PluginConfigParams::YES}},
+        {{InferenceEngine::PluginConfigInternalParams::KEY_EXPORTABLE_NETWORK, InferenceEngine::PluginConfigParams::YES},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportExportNetwork, ImportExportNetworkTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputPrecisions),
+                                ::testing::ValuesIn(configs)),
+                        ImportExportNetworkTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,140 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <sstream>
+
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <functional_test_utils/blob_utils.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::Precision,         // Input precision
+        InferenceEngine::Layout,            // Input layout
+        bool,                               // Subtract mean values
+        bool                                // Apply scales
+> inputMeanValuesParams;
+
+// Compares inference with mean values and scales pre-processing against the same network fed with
+// manually pre-processed data. Scales are applied with and without mean values
+class InputMeanValuesTest : public testing::WithParamInterface<inputMeanValuesParams>,
+                            public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<inputMeanValuesParams> obj) {
+        InferenceEngine::Precision inputPrecision;
+        InferenceEngine::Layout inputLayout;
+        bool withMeans, withScales;
+        std::tie(inputPrecision, inputLayout, withMeans, withScales) = obj.param;
+
+        std::ostringstream result;
+        result << "inPRC=" << inputPrecision.name() << "_";
+        result << "inL=" << inputLayout << "_";
+        result << "means=" << withMeans << "_";
+        result << "scales=" << withScales;
+        return result.str();
+    }
+
+    void Run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        const size_t channels = inputShape[1];
+        std::vector<float> means(channels, 0.0f), scales(channels, 1.0f);
+        for (size_t c = 0; c < channels; c++) {
+            if (withMeans) {
+                means[c] = 10.0f * (c + 1);
+            }
+            if (withScales) {
+                scales[c] = 1.0f / (c + 2);
+            }
+        }
+
+        InferenceEngine::CNNNetwork network(function);
+        auto inputInfo = network.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(inPrc);
+        inputInfo->setLayout(inLayout);
+        auto &preProcess = inputInfo->getPreProcess();
+        preProcess.init(channels);
+        for (size_t c = 0; c < channels; c++) {
+            preProcess[c]->meanValue = means[c];
+            preProcess[c]->stdScale = scales[c];
+        }
+        preProcess.setVariant(withMeans ? InferenceEngine::MEAN_VALUE : InferenceEngine::NONE);
+
+        auto request = core->LoadNetwork(network, targetDevice, configuration).CreateInferRequest();
+        auto input = FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc(), 100, 0);
+        request.SetBlob(inputInfo->name(), input);
+        request.Infer();
+
+        InferenceEngine::CNNNetwork refNetwork(function);
+        auto refInputInfo = refNetwork.getInputsInfo().begin()->second;
+        refInputInfo->setPrecision(InferenceEngine::Precision::FP32);
+        refInputInfo->setLayout(inLayout);
+
+        auto refInput = InferenceEngine::make_shared_blob<float>(refInputInfo->getTensorDesc());
+        refInput->allocate();
+        auto convertedInput = FuncTestUtils::copyBlobWithCast<InferenceEngine::Precision::FP32>(input);
+        const auto src = convertedInput->cbuffer().as<const float *>();
+        auto dst = refInput->buffer().as<float *>();
+        const size_t spatialSize = refInput->size() / channels;
+        for (size_t i = 0; i < refInput->size(); i++) {
+            const size_t c = inLayout == InferenceEngine::Layout::NHWC ? i % channels : i / spatialSize;
+            dst[i] = (src[i] - means[c]) * scales[c];
+        }
+
+        auto refRequest = core->LoadNetwork(refNetwork, targetDevice).CreateInferRequest();
+        refRequest.SetBlob(refInputInfo->name(), refInput);
+        refRequest.Infer();
+
+        for (auto &&output : network.getOutputsInfo()) {
+            Compare(refRequest.GetBlob(output.first), request.GetBlob(output.first));
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::tie(inPrc, inLayout, withMeans, withScales) = this->GetParam();
+        function = ngraph::builder::subgraph::makeSplitConvConcat(inputShape);
+    }
+
+    std::vector<size_t> inputShape = {1, 4, 20, 20};
+    bool withMeans = false;
+    bool withScales = false;
+};
+
+TEST_P(InputMeanValuesTest, CompareWithRefs) {
+    Run();
+};
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> inputPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::U8,
+        InferenceEngine::Precision::I16
+};
+
+const std::vector<InferenceEngine::Layout> inputLayouts = {
+        InferenceEngine::Layout::NCHW,
+        InferenceEngine::Layout::NHWC
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_InputMeanValues, InputMeanValuesTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputPrecisions),
+                                ::testing::ValuesIn(inputLayouts),
+                                ::testing::Bool(),
+                                ::testing::Bool()),
+                        InputMeanValuesTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        size_t,                         // Number of convolutions consuming the MVN output
+        std::string                     // Device name
+> LayoutPlannerTuple;
+
+class LayoutPlannerTest : public testing::WithParamInterface<LayoutPlannerTuple>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayoutPlannerTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        size_t numConvolutions;
+        std::string targetName;
+        std::tie(inputShape, numConvolutions, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Convolutions=" << numConvolutions << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    // MVN takes the planar layout of the network input, as it matches its producer best, while every
+    // convolution consumer needs a blocked one. So the greedy selection inserts a reorder for each
+    // convolution, and the planner replaces them with a single reorder in front of MVN.
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        size_t numConvolutions;
+        std::tie(inputShape, numConvolutions, targetDevice) = this->GetParam();
+        configuration[InferenceEngine::CPUConfigParams::KEY_CPU_LAYOUT_PLANNER] = InferenceEngine::PluginConfigParams::YES;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        // the second consumer of the input keeps MVN from running in-place
+        auto relu = ngraph::builder::makeActivation(params[0], ngraph::element::f32, ngraph::helpers::ActivationTypes::Relu);
+        auto mvn = ngraph::builder::makeMVN(params[0], false, true, 1e-9);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        for (size_t i = 0; i < numConvolutions; i++) {
+            auto convolution = ngraph::builder::makeConvolution(mvn, ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0},
+                                                                {1, 1}, ngraph::op::PadType::EXPLICIT, inputShape[1]);
+            results.push_back(std::make_shared<ngraph::opset1::Result>(convolution));
+        }
+        function = std::make_shared<ngraph::Function>(results, params, "layout_planner");
+    }
+
+    static size_t countReorders(InferenceEngine::ExecutableNetwork &network) {
+        size_t numReorders = 0;
+        auto execFunction = network.GetExecGraphInfo().getFunction();
+        for (const auto &op : execFunction->get_ops()) {
+            const auto &rtInfo = op->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it == rtInfo.end())
+                continue;
+            auto opType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            if (opType && opType->get() == "Reorder")
+                numReorders++;
+        }
+        return numReorders;
+    }
+};
+
+TEST_P(LayoutPlannerTest, FewerReordersThanGreedySelection) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto greedy = core->LoadNetwork(cnnNetwork, targetDevice);
+    ASSERT_LT(countReorders(executableNetwork), countReorders(greedy));
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 16, 10, 10},
+        {2, 32, 7, 9},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_LayoutPlanner, LayoutPlannerTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(2, 3),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LayoutPlannerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
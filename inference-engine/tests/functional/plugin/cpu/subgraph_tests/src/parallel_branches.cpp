@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string,                    // Number of streams
+        size_t,                         // Number of async requests
+        std::string                     // Device name
+> ParallelBranchesTuple;
+
+class ParallelBranchesTest : public testing::WithParamInterface<ParallelBranchesTuple>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelBranchesTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        std::string streams;
+        size_t numRequests;
+        std::string targetName;
+        std::tie(inputShape, streams, numRequests, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Streams=" << streams << "_";
+        results << "Requests=" << numRequests << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    // Four independent branches of different length that meet in in-place consumers:
+    // a Split feeding a Concat inside one branch, an Eltwise and the final Concat
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::string streams;
+        std::tie(inputShape, streams, numRequests, targetDevice) = this->GetParam();
+        configuration[InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES] = InferenceEngine::PluginConfigParams::YES;
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = streams;
+
+        const size_t channels = inputShape[1];
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto makeConv = [](const ngraph::Output<ngraph::Node>& in, size_t kernel, size_t channels) {
+            std::ptrdiff_t pad = kernel / 2;
+            return ngraph::builder::makeConvolution(in, ngraph::element::f32, {kernel, kernel}, {1, 1}, {pad, pad},
+                                                    {pad, pad}, {1, 1}, ngraph::op::PadType::EXPLICIT, channels, true);
+        };
+
+        auto branch0 = std::make_shared<ngraph::opset1::Relu>(makeConv(params[0], 3, channels));
+
+        auto branch1 = std::make_shared<ngraph::opset1::Sigmoid>(makeConv(makeConv(params[0], 1, channels), 3, channels));
+
+        auto split = ngraph::builder::makeSplit(makeConv(params[0], 3, channels), ngraph::element::f32, 2, 1);
+        auto splitConv0 = std::make_shared<ngraph::opset1::Relu>(makeConv(split->output(0), 3, channels / 2));
+        auto splitConv1 = std::make_shared<ngraph::opset1::Tanh>(makeConv(split->output(1), 1, channels / 2));
+        auto branch2 = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{splitConv0, splitConv1}, 1);
+
+        auto branch3 = std::make_shared<ngraph::opset1::Add>(makeConv(params[0], 1, channels), branch0);
+
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{branch0, branch1, branch2, branch3}, 1);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "parallel_branches");
+    }
+
+    size_t numRequests = 0;
+};
+
+// Branches of concurrent requests run on the threads of their streams, so every stream must
+// reproduce the serial execution of the same network
+TEST_P(ParallelBranchesTest, ConcurrentRequestsMatchSerialExecution) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto serial = core->LoadNetwork(cnnNetwork, targetDevice,
+        {{InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::NO}});
+    auto inputInfo = *executableNetwork.GetInputsInfo().begin();
+    auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    for (int seed = 1; seed <= 3; seed++) {
+        auto input = FuncTestUtils::createAndFillBlob(inputInfo.second->getTensorDesc(), 10, -5, 1, seed);
+        auto refRequest = serial.CreateInferRequest();
+        refRequest.SetBlob(inputInfo.first, input);
+        refRequest.Infer();
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (size_t i = 0; i < numRequests; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            requests.back().SetBlob(inputInfo.first, input);
+            requests.back().StartAsync();
+        }
+        for (auto &request : requests) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            FuncTestUtils::compareBlobs(request.GetBlob(outputName), refRequest.GetBlob(outputName));
+        }
+    }
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 4, 9, 13},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ParallelBranches, ParallelBranchesTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values("1", "2"),
+                                ::testing::Values(4),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        bool,                           // Performance counters enabled
+        size_t,                         // Number of inferences
+        std::string                     // Device name
+> PerfHistogramsTuple;
+
+class PerfHistogramsTest : public testing::WithParamInterface<PerfHistogramsTuple>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PerfHistogramsTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        bool perfCount;
+        size_t numInfers;
+        std::string targetName;
+        std::tie(inputShape, perfCount, numInfers, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "PerfCount=" << perfCount << "_";
+        results << "Infers=" << numInfers << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::tie(inputShape, perfCount, numInfers, targetDevice) = this->GetParam();
+        if (perfCount) {
+            configuration[InferenceEngine::PluginConfigParams::KEY_PERF_COUNT] = InferenceEngine::PluginConfigParams::YES;
+        }
+
+        // multiply is not fused into the convolution as a sum would be, so all three nodes get histograms
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, inputShape});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, inputShape[1]);
+        auto pooling = ngraph::builder::makePooling(params[1], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto multiply = ngraph::builder::makeEltwise(convolution, pooling, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(multiply)};
+        function = std::make_shared<ngraph::Function>(results, params, "perf_histograms");
+    }
+
+    bool perfCount = false;
+    size_t numInfers = 0;
+};
+
+TEST_P(PerfHistogramsTest, EachNodeHasOneSamplePerInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    for (size_t i = 1; i < numInfers; i++) {
+        inferRequest.Infer();
+    }
+
+    std::string json = executableNetwork.GetMetric(METRIC_KEY(CPU_PERF_HISTOGRAMS));
+    ASSERT_EQ(0u, json.find("{\"streams\":[{\"stream\":0,\"nodes\":["));
+    if (!perfCount) {
+        ASSERT_EQ(std::string::npos, json.find("\"count\":"));
+        return;
+    }
+
+    for (auto type : {"Convolution", "Pooling", "Eltwise"}) {
+        ASSERT_NE(std::string::npos, json.find(std::string("\"type\":\"") + type + "\"")) << type;
+    }
+
+    // every reported node was executed by each inference
+    const std::string countKey = "\"count\":";
+    const std::string expectedCount = countKey + std::to_string(numInfers) + ",";
+    size_t numReported = 0;
+    for (auto pos = json.find(countKey); pos != std::string::npos; pos = json.find(countKey, pos + 1)) {
+        ASSERT_EQ(0, json.compare(pos, expectedCount.size(), expectedCount));
+        numReported++;
+    }
+    ASSERT_GE(numReported, 3u);
+    ASSERT_NE(std::string::npos, json.find("\"p99_us\":"));
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 3, 10, 7},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_PerfHistograms, PerfHistogramsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(true, false),
+                                ::testing::Values(1, 10),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        PerfHistogramsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_compound_blob.h>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+// Regions set as one ROIsBlob give the same results as each region set as a ROI blob of its own
+TEST(ROIsPreprocessingTest, RegionsMatchSeparateInference) {
+    auto ie = PluginCache::get().ie();
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat({2, 4, 20, 20}));
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    auto inputName = inputInfo->name();
+    auto outputName = network.getOutputsInfo().begin()->first;
+    inputInfo->setPrecision(InferenceEngine::Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+
+    auto image = FuncTestUtils::createAndFillBlob({InferenceEngine::Precision::U8, {1, 4, 48, 64},
+                                                   InferenceEngine::Layout::NCHW});
+    std::vector<InferenceEngine::ROI> rois = {{0, 0, 0, 32, 24}, {0, 16, 8, 48, 40}};
+
+    auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    request.SetBlob(inputName, std::make_shared<InferenceEngine::ROIsBlob>(image, rois));
+    request.Infer();
+    auto output = InferenceEngine::as<InferenceEngine::MemoryBlob>(request.GetBlob(outputName));
+    auto outputMemory = output->rmap();
+    const size_t slotSize = output->size() / rois.size();
+
+    network.setBatchSize(1);
+    auto refRequest = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    for (size_t i = 0; i < rois.size(); i++) {
+        refRequest.SetBlob(inputName, image->createROI(rois[i]));
+        refRequest.Infer();
+        auto refOutput = InferenceEngine::as<InferenceEngine::MemoryBlob>(refRequest.GetBlob(outputName));
+        auto refMemory = refOutput->rmap();
+        FuncTestUtils::compareRawBuffers(outputMemory.as<const float*>() + i * slotSize,
+                                         refMemory.as<const float*>(), slotSize, refOutput->size());
+    }
+}
+
+TEST(ROIsPreprocessingTest, MoreRegionsThanBatchAreRejected) {
+    auto ie = PluginCache::get().ie();
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat());
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(InferenceEngine::Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+
+    auto image = FuncTestUtils::createAndFillBlob({InferenceEngine::Precision::U8, {1, 4, 48, 64},
+                                                   InferenceEngine::Layout::NCHW});
+    auto rois = std::make_shared<InferenceEngine::ROIsBlob>(
+        image, std::vector<InferenceEngine::ROI>{{0, 0, 0, 32, 24}, {0, 16, 8, 48, 40}});
+
+    auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    ASSERT_THROW(request.SetBlob(inputInfo->name(), rois), InferenceEngine::details::InferenceEngineException);
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,114 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector,    // Input shape
+        std::string,                    // Number of throughput streams
+        size_t,                         // Number of async infer requests
+        std::string                     // Device name
+> StreamGraphsTuple;
+
+// Graphs of all streams except the first one reuse the compilation results of the first graph
+class StreamGraphsTest : public testing::WithParamInterface<StreamGraphsTuple>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StreamGraphsTuple> &obj) {
+        InferenceEngine::SizeVector inputShape;
+        std::string streams;
+        size_t numRequests;
+        std::string targetName;
+        std::tie(inputShape, streams, numRequests, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Streams=" << streams << "_";
+        results << "Requests=" << numRequests << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    // fused, in-place and reordered nodes all depend on the compilation results shared between streams
+    void SetUp() override {
+        InferenceEngine::SizeVector inputShape;
+        std::string streams;
+        std::tie(inputShape, streams, numRequests, targetDevice) = this->GetParam();
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = streams;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto convolution = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                            {1, 1}, ngraph::op::PadType::EXPLICIT, 16);
+        auto relu = ngraph::builder::makeActivation(convolution, ngraph::element::f32, ngraph::helpers::ActivationTypes::Relu);
+        auto pooling = ngraph::builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto concat = ngraph::builder::makeConcat({relu, pooling}, 1);
+        auto output = ngraph::builder::makeConvolution(concat, ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0},
+                                                       {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "stream_graphs");
+    }
+
+    size_t numRequests = 0;
+};
+
+TEST_P(StreamGraphsTest, AllStreamsMatchSingleStream) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto singleStream = core->LoadNetwork(cnnNetwork, targetDevice);
+    uint64_t refWorkspaceSize = singleStream.GetMetric(METRIC_KEY(CPU_WORKSPACE_SIZE));
+    uint64_t workspaceSize = executableNetwork.GetMetric(METRIC_KEY(CPU_WORKSPACE_SIZE));
+    ASSERT_EQ(refWorkspaceSize, workspaceSize);
+
+    // the requests are spread over all streams, each of them must match the validated first request
+    auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[0]);
+        requests.back().StartAsync();
+    }
+    for (auto &request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        for (auto &&output : executableNetwork.GetOutputsInfo()) {
+            FuncTestUtils::compareBlobs(request.GetBlob(output.first), inferRequest.GetBlob(output.first));
+        }
+    }
+}
+
+namespace {
+
+const std::vector<InferenceEngine::SizeVector> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 3, 9, 7},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_StreamGraphs, StreamGraphsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values("2", "4"),
+                                ::testing::Values(8),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        StreamGraphsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -623,4 +623,37 @@ TEST_P(InferRequestTests, returnDeviceBusyOnGetPerformanceCountAfterAsyncInfer)
         std::cout << "Exception" << e.what() << std::endl;
     }
 }
+
+TEST_P(InferRequestTests, multiDeviceReportsSharesOfExecutedInferences) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (targetDevice.find(CommonTestUtils::DEVICE_MULTI) == std::string::npos) {
+        GTEST_SKIP() << "Applicable to the Multi-Device only";
+    }
+    // Create CNNNetwork from ngrpah::Function
+    InferenceEngine::CNNNetwork cnnNet(function);
+    // Load CNNNetwork to target plugins
+    auto execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration);
+    auto shares = execNet.GetMetric(METRIC_KEY(MULTI_DEVICE_SHARES)).as<std::map<std::string, float>>();
+    for (auto&& share : shares) {
+        ASSERT_EQ(0.f, share.second);
+    }
+    std::vector<InferenceEngine::InferRequest> requests(4);
+    for (auto&& req : requests) {
+        req = execNet.CreateInferRequest();
+        req.StartAsync();
+    }
+    for (auto&& req : requests) {
+        ASSERT_EQ(static_cast<int>(InferenceEngine::StatusCode::OK),
+                  req.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+    }
+    shares = execNet.GetMetric(METRIC_KEY(MULTI_DEVICE_SHARES)).as<std::map<std::string, float>>();
+    ASSERT_FALSE(shares.empty());
+    float total = 0.f;
+    for (auto&& share : shares) {
+        ASSERT_GE(share.second, 0.f);
+        total += share.second;
+    }
+    ASSERT_NEAR(1.f, total, 1e-5f);
+}
 }  // namespace BehaviorTestsDefinitions
\ No newline at end of file
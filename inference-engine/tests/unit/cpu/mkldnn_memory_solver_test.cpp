@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <random>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -114,7 +115,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,7 +124,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -233,9 +234,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +272,27 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, NoOverlappingWithoutExactSearch) {
+    std::mt19937 gen(42);
+    std::vector<Box> boxes;
+    for (int i = 0; i < 1000; i++) {
+        int start = gen() % 500;
+        boxes.push_back({start, start + static_cast<int>(gen() % 8), static_cast<int64_t>(gen() % 100 + 1), i});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes, 0);
+    int64_t required = ms.solve();
+    EXPECT_GE(required, ms.maxDepth());
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        EXPECT_LE(ms.getOffset(boxes[i].id) + boxes[i].size, required);
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            const Box &box1 = boxes[i], &box2 = boxes[j];
+            int64_t off1 = ms.getOffset(box1.id);
+            int64_t off2 = ms.getOffset(box2.id);
+            ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish ||
+                        off1 + box1.size <= off2 || off1 >= off2 + box2.size) << "Box overlapping is detected";
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "mkldnn_workspace_pool.hpp"
+
+using namespace MKLDNNPlugin;
+
+class MKLDNNWorkspacePoolTest : public ::testing::Test {
+protected:
+    mkldnn::engine eng{mkldnn::engine::kind::cpu, 0};
+    MKLDNNWorkspacePool pool;
+};
+
+TEST_F(MKLDNNWorkspacePoolTest, AllocatesBlockPerConcurrentInference) {
+    auto first = pool.acquire(1024, eng);
+    auto second = pool.acquire(1024, eng);
+    ASSERT_NE(first, second);
+    ASSERT_GE(first->GetSize(), 1024u);
+    ASSERT_EQ(2u, pool.size());
+
+    pool.release(first);
+    pool.release(second);
+    auto third = pool.acquire(512, eng);
+    ASSERT_TRUE(third == first || third == second);
+    ASSERT_EQ(2u, pool.size());
+}
+
+TEST_F(MKLDNNWorkspacePoolTest, ReusesBlockAcrossStreams) {
+    MKLDNNMemoryPtr first, second;
+    // Graphs of different streams run inference in different threads
+    std::thread([&] {
+        first = pool.acquire(4096, eng);
+        pool.release(first);
+    }).join();
+    std::thread([&] {
+        second = pool.acquire(4096, eng);
+        pool.release(second);
+    }).join();
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1u, pool.size());
+}
+
+TEST_F(MKLDNNWorkspacePoolTest, TakesSmallestFittingBlock) {
+    auto large = pool.acquire(8192, eng);
+    auto small = pool.acquire(1024, eng);
+    pool.release(large);
+    pool.release(small);
+
+    ASSERT_EQ(small, pool.acquire(512, eng));
+    ASSERT_EQ(large, pool.acquire(2048, eng));
+    ASSERT_EQ(2u, pool.size());
+
+    // No free block is large enough
+    auto larger = pool.acquire(16384, eng);
+    ASSERT_NE(large, larger);
+    ASSERT_EQ(3u, pool.size());
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <runtime/floatmath_blocked.hpp>
+
+using namespace GNAPluginNS::runtime;
+
+// output rows, input rows and columns (batch) of the component
+struct ComponentShape {
+    uint32_t rowsOut;
+    uint32_t rowsIn;
+    uint32_t columns;
+};
+
+namespace {
+
+// shapes of affine and recurrent components of speech_sample models (wsj_dnn5b, rm_lstm4f, rm_cnn4a)
+const std::vector<ComponentShape> speechShapes = {
+    {2048, 440, 8},
+    {2048, 2048, 8},
+    {3425, 2048, 8},
+    {1024, 1272, 1},
+    {512, 512, 4},
+    {1536, 512, 1},
+    {33, 35, 3},
+};
+
+std::vector<float> randomVector(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> result(size);
+    for (auto& value : result) {
+        value = dist(gen);
+    }
+    return result;
+}
+
+void referenceAffine(const ComponentShape& shape, const uint32_t* rowList, uint32_t outRows,
+                     const std::vector<float>& A, const std::vector<float>& B, std::vector<float>& C) {
+    for (uint32_t l = 0; l < outRows; l++) {
+        uint32_t i = rowList ? rowList[l] : l;
+        for (uint32_t j = 0; j < shape.columns; j++) {
+            float sum = C[l * shape.columns + j];
+            for (uint32_t k = 0; k < shape.rowsIn; k++) {
+                sum += A[i * shape.rowsIn + k] * B[k * shape.columns + j];
+            }
+            C[l * shape.columns + j] = sum;
+        }
+    }
+}
+
+void referenceSplit(uint32_t N, uint32_t K1, uint32_t K2, const std::vector<float>& A1, const std::vector<float>& A2,
+                    const std::vector<float>& X, const std::vector<float>& B, std::vector<float>& C) {
+    for (uint32_t i = 0; i < N; i++) {
+        float sum = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            sum += A1[j] * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = 0; j < K2; j++) {
+            sum += A2[j] * X[i * (K1 + K2) + K1 + j];
+        }
+        C[i] = sum;
+    }
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual, float tolerance) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], tolerance) << "at index " << i;
+    }
+}
+
+}  // namespace
+
+class GNAFloatMathTest : public ::testing::TestWithParam<ComponentShape> {
+protected:
+    std::mt19937 gen{42};
+};
+
+TEST_P(GNAFloatMathTest, affineMatchesReference) {
+    auto shape = GetParam();
+    auto A = randomVector(shape.rowsOut * shape.rowsIn, gen);
+    auto B = randomVector(shape.rowsIn * shape.columns, gen);
+    auto expected = randomVector(shape.rowsOut * shape.columns, gen);
+    auto actual = expected;
+
+    referenceAffine(shape, nullptr, shape.rowsOut, A, B, expected);
+    sgemmBlocked(shape.rowsOut, shape.columns, shape.rowsIn, A.data(), shape.rowsIn, B.data(), shape.columns,
+                 actual.data(), shape.columns);
+    expectNear(expected, actual, 1e-3f);
+}
+
+TEST_P(GNAFloatMathTest, affineActiveListMatchesReference) {
+    auto shape = GetParam();
+    auto A = randomVector(shape.rowsOut * shape.rowsIn, gen);
+    auto B = randomVector(shape.rowsIn * shape.columns, gen);
+    std::vector<uint32_t> rowList;
+    for (uint32_t i = shape.rowsOut; i > 0; i -= std::min(i, 3u)) {
+        rowList.push_back(i - 1);
+    }
+    const auto outRows = static_cast<uint32_t>(rowList.size());
+    auto expected = randomVector(outRows * shape.columns, gen);
+    auto actual = expected;
+
+    referenceAffine(shape, rowList.data(), outRows, A, B, expected);
+    sgemmBlocked(outRows, shape.columns, shape.rowsIn, A.data(), shape.rowsIn, B.data(), shape.columns,
+                 actual.data(), shape.columns, rowList.data());
+    expectNear(expected, actual, 1e-3f);
+}
+
+TEST_P(GNAFloatMathTest, recurrentMatchesReference) {
+    auto shape = GetParam();
+    const uint32_t N = shape.rowsOut, K1 = shape.rowsIn, K2 = shape.rowsOut;
+    auto A1 = randomVector(K1, gen);
+    auto A2 = randomVector(K2, gen);
+    auto X = randomVector(N * (K1 + K2), gen);
+    auto B = randomVector(N, gen);
+    std::vector<float> expected(N), actual(N);
+
+    referenceSplit(N, K1, K2, A1, A2, X, B, expected);
+    sgemvSplitBlocked(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), actual.data());
+    expectNear(expected, actual, 1e-3f);
+}
+
+INSTANTIATE_TEST_CASE_P(SpeechComponents, GNAFloatMathTest, ::testing::ValuesIn(speechShapes));
@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class ROIsBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -425,3 +426,37 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+TEST_F(ROIsBlobTests, canCreateROIsBlobFromImageAndRegions) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 6, 8}, NHWC));
+    image->allocate();
+    std::vector<ROI> rois = {{0, 0, 0, 8, 6}, {1, 2, 1, 4, 3}};
+    ROIsBlob::Ptr roisBlob = make_shared_blob<ROIsBlob>(image, rois);
+    EXPECT_EQ(image, roisBlob->image());
+    EXPECT_EQ(2u, roisBlob->rois().size());
+    EXPECT_EQ(Precision::U8, roisBlob->getTensorDesc().getPrecision());
+    EXPECT_THROW(roisBlob->createROI(rois[0]), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ROIsBlobTests, cannotCreateROIsBlobWithoutRegions) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    EXPECT_THROW(make_shared_blob<ROIsBlob>(image, std::vector<ROI>{}), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ROIsBlobTests, cannotCreateROIsBlobFromCompoundImage) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr image = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    EXPECT_THROW(make_shared_blob<ROIsBlob>(image, std::vector<ROI>{{0, 0, 0, 4, 4}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(ROIsBlobTests, cannotCreateROIsBlobWithRegionsOutOfImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    EXPECT_THROW(make_shared_blob<ROIsBlob>(image, std::vector<ROI>{{1, 0, 0, 4, 4}}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<ROIsBlob>(image, std::vector<ROI>{{0, 6, 0, 4, 4}}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<ROIsBlob>(image, std::vector<ROI>{{0, 0, 4, 4, 4}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
@@ -19,6 +19,7 @@
 #include <cstdio>
 #include <ctime>
 
+#include <algorithm>
 #include <chrono>
 
 #include <map>
@@ -73,6 +74,7 @@ cv::String interpToString(int interp)
     case cv::INTER_AREA   : return "INTER_AREA";
     case cv::INTER_LINEAR : return "INTER_LINEAR";
     case cv::INTER_NEAREST: return "INTER_NEAREST";
+    case cv::INTER_CUBIC  : return "INTER_CUBIC";
     }
     CV_Assert(!"ERROR: unsupported interpolation!");
     return nullptr;
@@ -687,12 +689,19 @@ TEST_P(ResizeTestIE, AccuracyTest)
     int depth = CV_MAT_DEPTH(type);
     CV_Assert(CV_8U == depth || CV_32F == depth);
 
-    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
-
     ASSERT_TRUE(in_mat1.isContinuous() && out_mat.isContinuous());
 
     using namespace InferenceEngine;
 
+    ResizeAlgorithm algorithm = NO_RESIZE;
+    switch (interp) {
+    case cv::INTER_AREA   : algorithm = RESIZE_AREA;     break;
+    case cv::INTER_LINEAR : algorithm = RESIZE_BILINEAR; break;
+    case cv::INTER_NEAREST: algorithm = RESIZE_NEAREST;  break;
+    case cv::INTER_CUBIC  : algorithm = RESIZE_BICUBIC;  break;
+    default: CV_Assert(!"ERROR: unsupported interpolation!");
+    }
+
     size_t  in_height = in_mat1.rows,  in_width = in_mat1.cols;
     size_t out_height = out_mat.rows, out_width = out_mat.cols;
     InferenceEngine::SizeVector  in_sv = { 1, channels,  in_height,  in_width };
@@ -710,7 +719,6 @@ TEST_P(ResizeTestIE, AccuracyTest)
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
     preprocess->setRoiBlob(in_blob);
 
-    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
     PreProcessInfo info;
     info.setResizeAlgorithm(algorithm);
 
@@ -735,6 +743,358 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+namespace {
+
+// Resizes the input with the bilinear algorithm and checks the result with OpenCV
+void resizeAndCheck(InferenceEngine::PreProcessDataPtr& preprocess, const cv::Mat& in_mat, const cv::Size& sz_out)
+{
+    using namespace InferenceEngine;
+
+#if defined(__arm__) || defined(__aarch64__)
+    const double tolerance = 4;
+#else
+    const double tolerance = 1;
+#endif
+    cv::Mat out_mat(sz_out, CV_8UC3);
+    cv::Mat out_mat_ocv(sz_out, CV_8UC3);
+
+    SizeVector  in_sv = { 1, 3, static_cast<size_t>(in_mat.rows), static_cast<size_t>(in_mat.cols) };
+    SizeVector out_sv = { 1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+    Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8,  in_sv, Layout::NHWC), in_mat.data);
+    Blob::Ptr out_blob = make_blob_with_precision(TensorDesc(Precision::U8, out_sv, Layout::NHWC), out_mat.data);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    preprocess->setRoiBlob(in_blob);
+    preprocess->execute(out_blob, info, false);
+
+    cv::resize(in_mat, out_mat_ocv, sz_out, 0, 0, cv::INTER_LINEAR);
+    EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance)
+        << "input " << in_mat.cols << "x" << in_mat.rows;
+}
+
+std::vector<cv::Mat> randomImages(const std::vector<cv::Size>& sizes)
+{
+    std::vector<cv::Mat> in_mats;
+    for (const auto& sz_in : sizes) {
+        cv::Mat in_mat(sz_in, CV_8UC3);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+        in_mats.push_back(in_mat);
+    }
+    return in_mats;
+}
+
+}  // namespace
+
+TEST(ResizeCacheTestIE, AlternatingInputSizes)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_out(300, 300);
+    const auto in_mats = randomImages({ cv::Size(640, 480), cv::Size(1280, 720), cv::Size(320, 240) });
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    size_t hits = 0, misses = 0;
+
+    // The first round compiles a graph for each input size
+    for (const auto& in_mat : in_mats) {
+        resizeAndCheck(preprocess, in_mat, sz_out);
+    }
+    preprocess->getCacheStats(hits, misses);
+    EXPECT_EQ(0, hits);
+    EXPECT_EQ(3, misses);
+
+    // The second round reuses them
+    for (const auto& in_mat : in_mats) {
+        resizeAndCheck(preprocess, in_mat, sz_out);
+    }
+    preprocess->getCacheStats(hits, misses);
+    EXPECT_EQ(3, hits);
+    EXPECT_EQ(3, misses);
+}
+
+TEST(ResizeCacheTestIE, EvictsLeastRecentlyUsedGraph)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_out(300, 300);
+    // One input size more than the cache holds
+    const auto in_mats = randomImages({ cv::Size(640, 480), cv::Size(1280, 720), cv::Size(320, 240),
+                                        cv::Size(800, 600), cv::Size(1920, 1080) });
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    size_t hits = 0, misses = 0;
+
+    for (const auto& in_mat : in_mats) {
+        resizeAndCheck(preprocess, in_mat, sz_out);
+    }
+    preprocess->getCacheStats(hits, misses);
+    EXPECT_EQ(0, hits);
+    EXPECT_EQ(5, misses);
+
+    // The four most recent sizes are still cached
+    for (size_t i = in_mats.size() - 1; i > 0; i--) {
+        resizeAndCheck(preprocess, in_mats[i], sz_out);
+    }
+    preprocess->getCacheStats(hits, misses);
+    EXPECT_EQ(4, hits);
+    EXPECT_EQ(5, misses);
+
+    // The first size was evicted
+    resizeAndCheck(preprocess, in_mats[0], sz_out);
+    preprocess->getCacheStats(hits, misses);
+    EXPECT_EQ(4, hits);
+    EXPECT_EQ(6, misses);
+}
+
+TEST(NormalizeTestIE, ResizeNormalizeU8ToPlanarF32)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_in(640, 480), sz_out(300, 300);
+    const std::vector<float> means  = { 103.53f, 116.28f, 123.675f };
+    const std::vector<float> scales = { 0.0174f, 0.0175f, 0.0171f };
+
+    cv::Mat in_mat(sz_in, CV_8UC3);
+    cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    for (auto fmt : { ColorFormat::RAW, ColorFormat::RGB }) {
+        SizeVector  in_sv = { 1, 3, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+        SizeVector out_sv = { 1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+        Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8, in_sv, Layout::NHWC), in_mat.data);
+        Blob::Ptr out_blob = make_shared_blob<float>(TensorDesc(Precision::FP32, out_sv, Layout::NCHW));
+        out_blob->allocate();
+
+        PreProcessInfo info;
+        info.init(3);
+        for (size_t c = 0; c < 3; c++) {
+            info[c]->meanValue = means[c];
+            info[c]->stdScale = scales[c];
+        }
+        info.setVariant(MEAN_VALUE);
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        info.setColorFormat(fmt);
+
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        preprocess->execute(out_blob, info, false, -1, true);
+
+#if PERF_TEST
+        // iterate testing, and print performance
+        test_ms([&](){ preprocess->execute(out_blob, info, false, -1, true); },
+                100, "Resize+Normalize IE %dx%d -> %dx%d", sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+        // OpenCV code /////////////////////////////////////////////////////////////
+        cv::Mat resized;
+        cv::resize(in_mat, resized, sz_out, 0, 0, cv::INTER_LINEAR);
+        if (fmt == ColorFormat::RGB) {
+            // network expects BGR
+            cv::cvtColor(resized, resized, cv::COLOR_RGB2BGR);
+        }
+        std::vector<cv::Mat> planes;
+        cv::split(resized, planes);
+
+        // Comparison //////////////////////////////////////////////////////////////
+        const float* out_data = out_blob->buffer().as<const float*>();
+        for (int c = 0; c < 3; c++) {
+            cv::Mat expected;
+            planes[c].convertTo(expected, CV_32F, scales[c], -means[c] * scales[c]);
+            cv::Mat actual(sz_out, CV_32FC1, const_cast<float*>(out_data) + c * sz_out.area());
+            // resized values may differ by one unit
+            EXPECT_LE(cv::norm(expected, actual, cv::NORM_INF), scales[c] + 1e-4)
+                << "channel " << c << ", color format " << fmt;
+        }
+    }
+}
+
+// Plugins subtract the mean values themselves, so it is applied by pre-processing only on request
+TEST(NormalizeTestIE, MeanValuesAreNotAppliedByDefault)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_in(640, 480), sz_out(300, 300);
+
+    cv::Mat in_mat(sz_in, CV_8UC3);
+    cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    SizeVector  in_sv = { 1, 3, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { 1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+    Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8, in_sv, Layout::NHWC), in_mat.data);
+    Blob::Ptr out_blob = make_shared_blob<float>(TensorDesc(Precision::FP32, out_sv, Layout::NCHW));
+    out_blob->allocate();
+
+    PreProcessInfo info;
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = 100.f;
+    }
+    info.setVariant(MEAN_VALUE);
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+    preprocess->execute(out_blob, info, false);
+
+    cv::Mat resized;
+    cv::resize(in_mat, resized, sz_out, 0, 0, cv::INTER_LINEAR);
+    std::vector<cv::Mat> planes;
+    cv::split(resized, planes);
+
+    const float* out_data = out_blob->buffer().as<const float*>();
+    for (int c = 0; c < 3; c++) {
+        cv::Mat expected;
+        planes[c].convertTo(expected, CV_32F);
+        cv::Mat actual(sz_out, CV_32FC1, const_cast<float*>(out_data) + c * sz_out.area());
+        // resized values may differ by one unit
+        EXPECT_LE(cv::norm(expected, actual, cv::NORM_INF), 1 + 1e-4) << "channel " << c;
+    }
+}
+
+TEST(LetterboxTestIE, KeepsAspectRatio)
+{
+    using namespace InferenceEngine;
+
+#if defined(__arm__) || defined(__aarch64__)
+    const double tolerance = 4;
+#else
+    const double tolerance = 1;
+#endif
+    const float pad_value = 114.f;
+    const cv::Size sz_out(300, 300);
+
+    // landscape input is padded at the top and the bottom, portrait one at the left and the right
+    for (const auto& sz_in : { cv::Size(640, 480), cv::Size(480, 640) }) {
+        cv::Mat in_mat(sz_in, CV_8UC3);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+        SizeVector  in_sv = { 1, 3, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+        SizeVector out_sv = { 1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+        Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8, in_sv, Layout::NHWC), in_mat.data);
+        Blob::Ptr out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, out_sv, Layout::NCHW));
+        out_blob->allocate();
+
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        info.setLetterbox(true, pad_value);
+
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        preprocess->execute(out_blob, info, false);
+
+        // OpenCV code /////////////////////////////////////////////////////////////
+        const cv::Size sz_inner = sz_in.width > sz_in.height ? cv::Size(300, 225) : cv::Size(225, 300);
+        const cv::Rect inner((sz_out.width - sz_inner.width) / 2, (sz_out.height - sz_inner.height) / 2,
+                             sz_inner.width, sz_inner.height);
+        cv::Mat resized;
+        cv::resize(in_mat, resized, sz_inner, 0, 0, cv::INTER_LINEAR);
+        std::vector<cv::Mat> planes;
+        cv::split(resized, planes);
+
+        // Comparison //////////////////////////////////////////////////////////////
+        const uint8_t* out_data = out_blob->buffer().as<const uint8_t*>();
+        for (int c = 0; c < 3; c++) {
+            cv::Mat actual(sz_out, CV_8UC1, const_cast<uint8_t*>(out_data) + c * sz_out.area());
+            EXPECT_LE(cv::norm(planes[c], actual(inner), cv::NORM_INF), tolerance) << "channel " << c;
+
+            cv::Mat mask(sz_out, CV_8UC1, cv::Scalar::all(255));
+            mask(inner).setTo(0);
+            cv::Mat pad(sz_out, CV_8UC1, cv::Scalar::all(pad_value));
+            EXPECT_EQ(0, cv::norm(pad, actual, cv::NORM_INF, mask)) << "channel " << c;
+        }
+    }
+}
+
+TEST(LetterboxTestIE, SaturatesPadValue)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_in(64, 32), sz_out(32, 32);
+    cv::Mat in_mat(sz_in, CV_8UC3, cv::Scalar::all(127));
+
+    SizeVector  in_sv = { 1, 3, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { 1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+    Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8, in_sv, Layout::NHWC), in_mat.data);
+    Blob::Ptr out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, out_sv, Layout::NCHW));
+    out_blob->allocate();
+
+    // pad values out of the U8 range are clamped, fractional ones are rounded
+    const std::vector<std::pair<float, uint8_t>> pad_values = { {300.f, 255}, {-5.f, 0}, {114.6f, 115} };
+    for (const auto& pad_value : pad_values) {
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BILINEAR);
+        info.setLetterbox(true, pad_value.first);
+
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        preprocess->execute(out_blob, info, false);
+
+        // the landscape input is padded at the top, so the first row of each channel is padding
+        const uint8_t* out_data = out_blob->buffer().as<const uint8_t*>();
+        for (int c = 0; c < 3; c++) {
+            for (int x = 0; x < sz_out.width; x++) {
+                EXPECT_EQ(pad_value.second, out_data[c * sz_out.area() + x]) << "pad " << pad_value.first;
+            }
+        }
+    }
+}
+
+TEST(MultiRoiTestIE, CropsToBatchSlots)
+{
+    using namespace InferenceEngine;
+
+    const cv::Size sz_in(640, 480), sz_out(64, 64);
+    const std::vector<cv::Rect> crops = { {0, 0, 640, 480}, {10, 20, 100, 150}, {300, 200, 37, 41},
+                                          {500, 100, 140, 380}, {7, 400, 250, 80} };
+
+    cv::Mat in_mat(sz_in, CV_8UC3);
+    cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    SizeVector  in_sv = { 1, 3, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { crops.size(), 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+    Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(Precision::U8, in_sv, Layout::NHWC), in_mat.data);
+    Blob::Ptr out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, out_sv, Layout::NCHW));
+    out_blob->allocate();
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+
+    // the second pass takes the crops in reverse order, so every thread gets crops of other sizes
+    for (bool reversed : { false, true }) {
+        std::vector<cv::Rect> order = crops;
+        if (reversed) std::reverse(order.begin(), order.end());
+
+        std::vector<ROI> rois;
+        for (const auto& r : order) {
+            rois.emplace_back(0, r.x, r.y, r.width, r.height);
+        }
+        preprocess->executeRois(in_blob, rois, out_blob, info, false);
+
+#if PERF_TEST
+        // iterate testing, and print performance
+        test_ms([&](){ preprocess->executeRois(in_blob, rois, out_blob, info, false); },
+                100, "Multi-ROI Resize IE %d crops -> %dx%d", static_cast<int>(rois.size()),
+                sz_out.width, sz_out.height);
+#endif
+
+        // OpenCV code /////////////////////////////////////////////////////////////
+        const uint8_t* out_data = out_blob->buffer().as<const uint8_t*>();
+        for (size_t i = 0; i < order.size(); i++) {
+            cv::Mat resized;
+            cv::resize(in_mat(order[i]), resized, sz_out, 0, 0, cv::INTER_LINEAR);
+            std::vector<cv::Mat> planes;
+            cv::split(resized, planes);
+
+            // Comparison //////////////////////////////////////////////////////////////
+            for (int c = 0; c < 3; c++) {
+                cv::Mat actual(sz_out, CV_8UC1, const_cast<uint8_t*>(out_data) + (i * 3 + c) * sz_out.area());
+                EXPECT_LE(cv::norm(planes[c], actual, cv::NORM_INF), 1)
+                    << "crop " << i << ", channel " << c;
+            }
+        }
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -88,6 +88,15 @@
     TEST_RESIZE_COPY, \
     TEST_RESIZE_SPECIAL
 
+// Integer ratios only, so every output pixel is taken from the same input pixel as OpenCV takes
+#define TEST_RESIZE_NEAREST \
+    std::make_pair(cv::Size(1920, 1080), cv::Size( 960,  540)), \
+    std::make_pair(cv::Size( 640,  480), cv::Size( 320,  240)), \
+    std::make_pair(cv::Size( 640,  480), cv::Size( 160,  480)), \
+    std::make_pair(cv::Size( 320,  240), cv::Size( 640,  480)), \
+    std::make_pair(cv::Size( 113,   71), cv::Size( 226,  142)), \
+    std::make_pair(cv::Size( 113,   71), cv::Size( 113,   71))
+
 #define TEST_SIZES_PREPROC \
     std::make_pair(cv::Size(1920, 1080), cv::Size(1024, 1024)), \
     std::make_pair(cv::Size(1280,  720), cv::Size( 544,  320)), \
@@ -225,6 +234,32 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(ResizeNearestTestFluid, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3, CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_NEAREST),
+                                Values(TEST_RESIZE_NEAREST),
+                                Values(0))); // exact match
+
+#if defined(__arm__) || defined(__aarch64__)
+INSTANTIATE_TEST_CASE_P(ResizeCubicTestFluid_U8, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(4))); // error not more than 4 unit
+#else
+INSTANTIATE_TEST_CASE_P(ResizeCubicTestFluid_U8, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(2))); // OpenCV uses fixed-point coefficients for U8
+#endif
+
+INSTANTIATE_TEST_CASE_P(ResizeCubicTestFluid_F32, ResizeTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05))); // error within 0.05 units
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -523,6 +523,26 @@ static std::vector<float> boxes = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0,
 static std::vector<float> scores = { 0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f };
 static std::vector<int> reference = { 0,0,3,0,0,0,0,0,5 };
 
+// Unit boxes on a grid with 0.5 step, so that only horizontal and vertical neighbours overlap with IoU above 0.3
+static std::vector<float> gridBoxes(size_t batches, size_t boxesNum) {
+    std::vector<float> data;
+    for (size_t b = 0; b < batches; b++) {
+        for (size_t i = 0; i < boxesNum; i++) {
+            float y = 0.5f * (i % 8), x = 0.5f * (i / 8);
+            data.insert(data.end(), { y, x, y + 1.f, x + 1.f });
+        }
+    }
+    return data;
+}
+
+// Distinct scores, so that the order of selected boxes is unambiguous
+static std::vector<float> distinctScores(size_t size) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = 0.01f + 0.98f * ((i * 7919) % size) / size;
+    return data;
+}
+
 INSTANTIATE_TEST_CASE_P(
         TestsNonMaxSuppression, MKLDNNCPUExtNonMaxSuppressionTFTests,
         ::testing::Values(
@@ -564,5 +584,9 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, {}, {}, 3, { 0,0,3,0,0,0,0,0,1 } }, /*nonmaxsuppression_no_iou_threshold_and_score_threshold*/
 
-            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} } /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} }, /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+
+            nmsTF_test_params{ 0, 1, { 2,4,64 }, gridBoxes(2, 64), distinctScores(2 * 4 * 64), { 64 }, { 0.3f }, { 0.2f }, 512, {} }, /*nonmaxsuppression_many_boxes*/
+
+            nmsTF_test_params{ 0, 0, { 2,4,64 }, gridBoxes(2, 64), distinctScores(2 * 4 * 64), { 20 }, { 0.3f }, { 0.f }, 160, {} } /*nonmaxsuppression_many_boxes_limit_output_size*/
 ));
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,8 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the ops of the function in topological order. The order is cached
+        ///        and reused until the graph version (see Node::get_graph_version()) changes.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -186,6 +189,13 @@ namespace ngraph
         // These nodes are not outputs of graph but should not be removed even if have no children.
         SinkVector m_sinks;
         ParameterVector m_parameters;
+
+        // Topological order cached for m_ordered_ops_version of the graph. Nodes are not owned
+        // by the cache, so nodes removed from the graph are released as soon as possible
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
+        mutable bool m_ordered_ops_valid{false};
     };
 
     template <>
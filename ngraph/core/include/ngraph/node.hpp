@@ -466,6 +466,15 @@ namespace ngraph
 
         virtual bool match_node(pattern::Matcher* matcher, const Output<Node>& graph_value);
 
+        /// \brief Returns the version of the graph structure. It is incremented by every change
+        ///        of node inputs or control dependencies, so a traversal of the graph cached for
+        ///        one version remains valid while the version is unchanged. Construction of a new
+        ///        node does not change the version, as nothing in a graph uses the node yet.
+        static size_t get_graph_version();
+
+        /// \brief Increments the graph structure version, see get_graph_version().
+        static void increment_graph_version();
+
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
@@ -477,6 +486,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
@@ -57,6 +57,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    Node::increment_graph_version();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -79,6 +80,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        Node::increment_graph_version();
     }
 }
 
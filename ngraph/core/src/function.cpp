@@ -123,6 +123,28 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    if (m_ordered_ops_valid && m_ordered_ops_version == Node::get_graph_version())
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (auto& op : m_ordered_ops)
+        {
+            auto node = op.lock();
+            if (node == nullptr)
+            {
+                break;
+            }
+            ordered_ops.push_back(node);
+        }
+        if (ordered_ops.size() == m_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
+    // Read the version before sorting, so a concurrent change invalidates the new cache
+    auto version = Node::get_graph_version();
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -137,7 +159,11 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_ordered_ops_version = version;
+    m_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -301,11 +327,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    Node::increment_graph_version();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    Node::increment_graph_version();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -375,12 +403,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    Node::increment_graph_version();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    Node::increment_graph_version();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -389,11 +419,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    Node::increment_graph_version();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    Node::increment_graph_version();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -403,6 +435,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    Node::increment_graph_version();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <typeindex>
@@ -32,6 +33,17 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
+
+size_t Node::get_graph_version()
+{
+    return m_graph_version.load();
+}
+
+void Node::increment_graph_version()
+{
+    m_graph_version.fetch_add(1);
+}
 
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
@@ -72,6 +84,7 @@ Node& Node::operator=(const Node& node)
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
+    increment_graph_version();
     return *this;
 }
 
@@ -189,6 +202,14 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    // A node without inputs and users, such as a node being constructed, is not reachable from
+    // the results of any function, so connecting it does not change the graph version
+    bool is_connected = !m_inputs.empty() || !m_control_dependents.empty() ||
+                        any_of(m_outputs.begin(),
+                               m_outputs.end(),
+                               [](const descriptor::Output& output) {
+                                   return !output.get_inputs().empty();
+                               });
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -197,6 +218,10 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    if (is_connected)
+    {
+        increment_graph_version();
+    }
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -496,6 +521,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        increment_graph_version();
     }
 }
 
@@ -528,6 +554,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            increment_graph_version();
         }
     }
     {
@@ -550,6 +577,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    increment_graph_version();
 }
 
 void Node::clear_control_dependents()
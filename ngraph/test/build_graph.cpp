@@ -19,6 +19,8 @@
 #include "ngraph/builder/autobroadcast.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
 #include <memory>
@@ -376,4 +378,68 @@ TEST(build_graph, build_graph_with_remove_result)
     EXPECT_EQ(results.size(), 1);
     nodes = f->get_ops();
     EXPECT_EQ(nodes.size(), 5);
-}
\ No newline at end of file
+}
+
+TEST(build_graph, ordered_ops_cache_follows_graph_changes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops.size(), 3);
+    auto version = Node::get_graph_version();
+    EXPECT_EQ(f->get_ordered_ops(), ordered_ops);
+    EXPECT_EQ(Node::get_graph_version(), version);
+
+    // Input::replace_source_output
+    auto abs = make_shared<op::Abs>(relu);
+    res->input(0).replace_source_output(abs);
+    EXPECT_GT(Node::get_graph_version(), version);
+    ordered_ops = f->get_ordered_ops();
+    ASSERT_EQ(ordered_ops.size(), 4);
+    EXPECT_EQ(ordered_ops[2], abs);
+
+    // replace_node, the cache must not keep the replaced node alive
+    weak_ptr<Node> replaced = abs;
+    auto neg = make_shared<op::Negative>(relu);
+    replace_node(abs, neg);
+    ordered_ops.clear();
+    abs.reset();
+    EXPECT_TRUE(replaced.expired());
+    ordered_ops = f->get_ordered_ops();
+    ASSERT_EQ(ordered_ops.size(), 4);
+    EXPECT_EQ(ordered_ops[2], neg);
+
+    // Function API
+    auto res2 = make_shared<op::Result>(relu);
+    f->add_results(ResultVector{res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+    f->remove_result(res2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}
+
+TEST(build_graph, ordered_ops_cache_survives_passes_without_changes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto ordered_ops = f->get_ordered_ops();
+    auto version = Node::get_graph_version();
+
+    pass::Manager manager;
+    manager.register_pass<pass::ConstantFolding>();
+    manager.run_passes(f);
+    // Nodes that are not used by the function do not invalidate the cache
+    auto unused = make_shared<op::Abs>(relu);
+    EXPECT_EQ(Node::get_graph_version(), version);
+    EXPECT_EQ(f->get_ordered_ops(), ordered_ops);
+
+    // Nodes become part of the function when an input of the function is connected to them
+    res->input(0).replace_source_output(unused);
+    EXPECT_GT(Node::get_graph_version(), version);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}